@@ -0,0 +1,125 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "batch.h"
+
+#define MIN(A, B)   ((A) < (B) ? (A) : (B))
+
+/* Jobs dealt to one worker, largest first. Its worker takes them from the
+ * head, and so do idle workers, which steal the largest job left. */
+typedef struct Deque {
+    pthread_mutex_t lock;
+    int *jobs;
+    int head, tail;
+} Deque;
+
+typedef struct Worker {
+    pthread_t thread;
+    Deque *deques;
+    int id, nworkers;
+    void **jobs;
+    int (*work)(void *job);
+    int failed;
+} Worker;
+
+typedef struct Entry {
+    uint64_t cost;
+    int job;
+} Entry;
+
+static int
+by_cost(const void *a, const void *b)
+{
+    uint64_t x = ((const Entry *) a)->cost, y = ((const Entry *) b)->cost;
+    return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static int
+take(Deque *deque)
+{
+    int job = -1;
+
+    pthread_mutex_lock(&deque->lock);
+    if (deque->head < deque->tail)
+        job = deque->jobs[deque->head++];
+    pthread_mutex_unlock(&deque->lock);
+    return job;
+}
+
+/* No jobs are added once the workers start, so a worker is done when it
+ * finds every deque empty. */
+static void *
+run_worker(void *arg)
+{
+    Worker *worker = arg;
+    int i, job;
+
+    for (;;) {
+        job = -1;
+        for (i = 0; job == -1 && i < worker->nworkers; i++)
+            job = take(&worker->deques[(worker->id + i) % worker->nworkers]);
+        if (job == -1)
+            break;
+        if (worker->work(worker->jobs[job]))
+            worker->failed++;
+    }
+    return NULL;
+}
+
+/* Run work on each of the jobs, from nworkers threads. The costs (such
+ * as input sizes) order the jobs and deal them evenly to the workers.
+ * Return the number of jobs for which work failed (returned non-zero),
+ * or -1 if the pool could not be set up. */
+int
+run_batch(void **jobs, const uint64_t *costs, int njobs, int nworkers,
+          int (*work)(void *job))
+{
+    Entry *entries;
+    Deque *deques;
+    Worker *workers;
+    int *dealt;
+    int i, n, failed = -1;
+
+    if (njobs <= 0)
+        return 0;
+    nworkers = nworkers < 1 ? 1 : MIN(nworkers, njobs);
+    entries = malloc(njobs * sizeof(*entries));
+    dealt = malloc(njobs * sizeof(*dealt));
+    deques = calloc(nworkers, sizeof(*deques));
+    workers = calloc(nworkers, sizeof(*workers));
+    if (!entries || !dealt || !deques || !workers)
+        goto no_pool;
+    for (i = 0; i < njobs; i++)
+        entries[i] = (Entry) {costs[i], i};
+    qsort(entries, njobs, sizeof(*entries), by_cost);
+    for (i = 0; i < nworkers; i++) {
+        pthread_mutex_init(&deques[i].lock, NULL);
+        deques[i].jobs = &dealt[i * (njobs / nworkers) + MIN(i, njobs % nworkers)];
+    }
+    for (i = 0; i < njobs; i++) {
+        Deque *deque = &deques[i % nworkers];
+        deque->jobs[deque->tail++] = entries[i].job;
+    }
+    for (i = 0; i < nworkers; i++)
+        workers[i] = (Worker) {0, deques, i, nworkers, jobs, work, 0};
+    /* workers that could not be started leave their jobs to the others */
+    for (n = 0; n < nworkers; n++)
+        if (pthread_create(&workers[n].thread, NULL, run_worker, &workers[n]))
+            break;
+    if (!n)
+        run_worker(&workers[0]);
+    for (i = 0; i < n; i++)
+        pthread_join(workers[i].thread, NULL);
+    failed = 0;
+    for (i = 0; i < nworkers; i++) {
+        failed += workers[i].failed;
+        pthread_mutex_destroy(&deques[i].lock);
+    }
+no_pool:
+    free(workers);
+    free(deques);
+    free(dealt);
+    free(entries);
+    return failed;
+}
@@ -0,0 +1,4 @@
+#include <stdint.h>
+
+int run_batch(void **jobs, const uint64_t *costs, int njobs, int nworkers,
+              int (*work)(void *job));
@@ -0,0 +1,410 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "term.h"
+#include "mbf.h"
+#include "gif.h"
+#include "congif.h"
+#include "session.h"
+#include "default_font.h"
+
+#define MIN(A, B)   ((A) < (B) ? (A) : (B))
+#define MAX(A, B)   ((A) > (B) ? (A) : (B))
+
+#define MIN_DELAY   6
+
+/* centiseconds elapsed at t microseconds, rounded */
+#define CS(T)       (((T) + 5000) / 10000)
+/* microseconds from the first line to tick k */
+#define TICK(K, FPS)    ((int64_t) (K) * 1000000 / (FPS))
+
+/* The built-in font is indexed once, for all sessions. */
+static pthread_once_t font_once = PTHREAD_ONCE_INIT;
+static int font_ok;
+
+static void
+init_default_font(void)
+{
+    font_ok = init_font(default_font) == 0;
+}
+
+static uint8_t
+get_pair(Term *term, int row, int col)
+{
+    Cell cell;
+    uint8_t fore, back;
+    int inverse;
+
+    inverse = term->mode & M_REVERSE;
+    if (term->mode & M_CURSORVIS)
+        inverse = term->row == row && term->col == col ? !inverse : inverse;
+    cell = term->addr[row][col];
+    inverse = cell.attr & A_INVERSE ? !inverse : inverse;
+    fore = cell.pair >> 4;
+    back = cell.pair & 0xF;
+    if (cell.attr & (A_ITALIC | A_CROSSED))
+        fore = 0x2;
+    else if (cell.attr & A_UNDERLINE)
+        fore = 0x6;
+    else if (cell.attr & A_DIM)
+        fore = 0x8;
+    if (inverse) {
+        uint8_t t;
+        t = fore; fore = back; back = t;
+    }
+    if (cell.attr & A_BOLD)
+        fore |= 0x8;
+    if (cell.attr & A_BLINK)
+        back |= 0x8;
+    if ((cell.attr & A_INVISIBLE) != 0) fore = back;
+    return (fore << 4) | (back & 0xF);
+}
+
+static void
+draw_char(Cache *cache, GIF *gif, uint16_t code, uint8_t pair, int row, int col)
+{
+    Font *font = cache->font;
+    int i, j;
+    int index;
+    uint8_t fore, back;
+    uint8_t *mask, *pixels;
+
+    index = get_index(font, code);
+    if (index == -1)
+        return;
+    mask = get_mask(cache, index);
+    fore = pair >> 4;
+    back = pair & 0xF;
+    pixels = &gif->cur[font->header.h * row * gif->w + font->header.w * col];
+    for (i = 0; i < font->header.h; i++) {
+        for (j = 0; j < font->header.w; j++)
+            pixels[j] = (mask[j] & fore) | (~mask[j] & back);
+        pixels += gif->w;
+        mask += font->header.w;
+    }
+}
+
+/* Draw the damaged cells of the terminal. */
+static void
+draw(Session *s)
+{
+    Term *term = s->term;
+    Cache *cache = s->cache;
+    GIF *gif = s->gif;
+    Font *font = cache->font;
+    int i, j;
+    uint16_t code;
+    uint8_t pair;
+    Span *span;
+
+    if (!s->cfg.cursor)
+        term->mode &= ~M_CURSORVIS;
+    damage_cursor(term);
+    for (i = 0; i < term->rows; i++) {
+        span = &term->damage[i];
+        if (span->lo >= span->hi)
+            continue;
+        for (j = span->lo; j < span->hi; j++) {
+            code = term->addr[i][j].code;
+            pair = get_pair(term, i, j);
+            draw_char(cache, gif, code, pair, i, j);
+        }
+        mark_drawn(gif, span->lo * font->header.w, i * font->header.h,
+                   (span->hi - span->lo) * font->header.w, font->header.h);
+        *span = (Span) {term->cols, 0};
+    }
+
+    if (term->plt_local)
+        gif->plt = term->plt;
+    else
+        gif->plt = 0;
+    gif->plt_dirty |= term->plt_dirty;
+    term->plt_dirty = 0;
+}
+
+static void
+render(Session *s, uint16_t delay)
+{
+    draw(s);
+    add_frame(s->gif, delay);
+    if (s->cfg.flush)
+        flush_gif(s->gif);
+}
+
+/* No window, no speedup, and the default palette and font. */
+void
+default_config(Config *cfg)
+{
+    memset(cfg, 0, sizeof(*cfg));
+    pthread_once(&font_once, init_default_font);
+    if (font_ok)
+        cfg->font = default_font;
+    load_palette("@xterm", cfg->plt);
+    cfg->maxdelay = INT64_MAX;
+    cfg->divisor = 1.0;
+    cfg->loop = -1;
+    cfg->cursor = 1;
+    cfg->rects = 1;
+}
+
+static int
+add_output(Session *s, WriteFunc write, void *arg, int part)
+{
+    Font *font = s->cfg.font;
+    uint16_t w, h;
+
+    w = s->term->cols * font->header.w;
+    h = s->term->rows * font->header.h;
+    if (!part && s->warm && s->warm->font == font)
+        s->cache = s->warm;
+    else
+        s->cache = new_cache(font);
+    if (!s->cache)
+        goto no_cache;
+    if (part)
+        s->gif = new_part(write, arg, w, h, s->cfg.threads);
+    else
+        s->gif = new_gif(write, arg, w, h, s->term->plt, s->cfg.loop,
+                         s->cfg.async, s->cfg.threads);
+    if (!s->gif)
+        goto no_gif;
+    s->gif->max_rects = s->cfg.rects;
+    s->gif->bands = s->cfg.bands;
+    return 0;
+no_gif:
+    if (s->cache != s->warm)
+        free(s->cache);
+    s->cache = NULL;
+no_cache:
+    return -1;
+}
+
+/* A session whose GIF is handed to write, along with arg. Without write,
+ * the session is only played, which is enough to follow the terminal. */
+Session *
+new_session(const Config *cfg, WriteFunc write, void *arg)
+{
+    return new_warm_session(cfg, NULL, write, arg);
+}
+
+/* Same as new_session(), drawing with the glyphs of warm if they are of
+ * the font, which is then left to the caller. */
+Session *
+new_warm_session(const Config *cfg, Cache *warm, WriteFunc write, void *arg)
+{
+    Session *s;
+
+    if (cfg->rows <= 0 || cfg->cols <= 0)
+        goto no_session;
+    s = calloc(1, sizeof(*s));
+    if (!s)
+        goto no_session;
+    s->cfg = *cfg;
+    s->warm = warm;
+    if (!s->cfg.font) {
+        pthread_once(&font_once, init_default_font);
+        if (!font_ok)
+            goto no_term;
+        s->cfg.font = default_font;
+    }
+    s->term = new_term(cfg->rows, cfg->cols, cfg->plt);
+    if (!s->term)
+        goto no_term;
+    s->term->verbose = cfg->verbose;
+    s->last = 1;
+    if (write && add_output(s, write, arg, 0) == -1)
+        goto no_output;
+    return s;
+no_output:
+    free(s->term);
+no_term:
+    free(s);
+no_session:
+    return NULL;
+}
+
+/* Take in a timing line of us microseconds, showing the frames due before
+ * its bytes are fed, with the terminal as it is now. Return the number of
+ * frames due, which are only counted if the session is only played.
+ * Lines before the start of the window are only parsed, so the first frame
+ * shows the terminal as it is at the start, and the time left until the
+ * end of the window goes to the last frame. */
+long
+time_session(Session *s, int64_t us)
+{
+    Config *cfg = &s->cfg;
+    int64_t t = us, dt, clock;
+    long next, delay, due = 0, frames = 0;
+
+    if (s->ended)
+        return 0;
+    if (s->clock + t < cfg->start) {
+        s->clock += t;
+        s->line++;
+        return 0;
+    }
+    clock = s->clock + t;
+    if (cfg->end && clock > cfg->end) {
+        t = cfg->end - MAX(s->clock, cfg->start);
+        s->ended = 1;
+    } else if (s->clock < cfg->start) {
+        t = clock - cfg->start;
+    }
+    s->clock = clock;
+    dt = MIN(t, cfg->maxdelay);
+    if (cfg->divisor != 1.0)
+        dt = (int64_t) (dt / cfg->divisor + 0.5);
+    if (s->ended) {
+        /* what is left of the window goes to the last frame */
+        if (cfg->fps) {
+            s->now += dt;
+            s->rd = MIN(MAX(CS(s->now) - CS(TICK(s->tick, cfg->fps)), 0), 65535);
+        } else {
+            s->rd = MIN(CS(s->d + dt), 65535);
+        }
+    } else if (s->line && cfg->fps) {
+        /* show the screen as it is at every tick before this chunk,
+         * with delays rounded from the start to avoid drift */
+        s->now += dt;
+        if (s->now > TICK(s->tick, cfg->fps)) {
+            next = (s->now * cfg->fps + 999999) / 1000000;
+            due = CS(TICK(next, cfg->fps)) - CS(TICK(s->tick, cfg->fps));
+            s->tick = next;
+        }
+    } else {
+        s->d += dt;
+        s->rd = MIN(CS(s->d), 65535);
+        if (s->line && s->rd >= MIN_DELAY) {
+            due = s->rd;
+            s->d = 0;
+        }
+        if (s->line == 0) { s->id = s->rd; s->rd = 0; s->d = 0; }
+    }
+    s->line++;
+    for (; due > 0; due -= delay, frames++) {
+        delay = MIN(due, 65535);
+        if (s->cache)
+            render(s, delay);
+    }
+    return frames;
+}
+
+/* Parse bytes output by the last timing line, in as many pieces as
+ * needed. Bytes past the end of the window are dropped. */
+void
+feed_session(Session *s, const uint8_t *data, size_t len)
+{
+    if (!s->ended)
+        parse_buf(s->term, data, len);
+}
+
+long
+push_session(Session *s, int64_t us, const uint8_t *data, size_t len)
+{
+    long frames = time_session(s, us);
+    feed_session(s, data, len);
+    return frames;
+}
+
+/* Copy of a session, only played, from the same point. */
+Session *
+dup_session(Session *s)
+{
+    Session *copy = malloc(sizeof(*copy));
+    if (!copy)
+        return NULL;
+    *copy = *s;
+    copy->term = dup_term(s->term);
+    if (!copy->term) {
+        free(copy);
+        return NULL;
+    }
+    copy->cache = NULL;
+    copy->gif = NULL;
+    return copy;
+}
+
+/* Give a session that is only played an output of frames only, to be
+ * joined to a GIF with join_gif(). When shown is set, the screen as it is
+ * now was the last frame of the previous part. Return 0 on success, -1 on
+ * error. */
+int
+start_part(Session *s, WriteFunc write, void *arg, int shown, int last)
+{
+    if (add_output(s, write, arg, 1) == -1)
+        return -1;
+    s->last = last;
+    if (shown) {
+        draw(s);
+        skip_frame(s->gif);
+    }
+    return 0;
+}
+
+/* Append the frames of a part, written to fd by a session given to
+ * start_part(), to the GIF of s. The last frame is then up to the parts.
+ * Return 0 on success, -1 on error. */
+int
+join_part(Session *s, int fd)
+{
+    s->last = 0;
+    return join_gif(s->gif, fd);
+}
+
+/* Go on from the given timing line and clock, as the session was there
+ * when it was saved, such as in an index, or as a part left it. */
+void
+resume_session(Session *s, long line, int64_t clock)
+{
+    s->line = line;
+    s->clock = clock;
+}
+
+/* Timing lines taken in so far. */
+long
+session_line(Session *s)
+{
+    return s->line;
+}
+
+/* Microseconds of the timings taken in so far. */
+int64_t
+session_clock(Session *s)
+{
+    return s->clock;
+}
+
+/* Whether the end of the window has been reached. */
+int
+session_ended(Session *s)
+{
+    return s->ended;
+}
+
+struct Term *
+session_term(Session *s)
+{
+    return s->term;
+}
+
+/* Show the last frame, if it's up to this session, and finish the GIF.
+ * Return 0 if all of it was written, -1 otherwise. */
+int
+close_session(Session *s)
+{
+    int ret = 0;
+
+    if (s->cache) {
+        if (s->last)
+            render(s, MAX(s->rd + s->id, 1));
+        ret = close_gif(s->gif);
+        if (s->cache != s->warm)
+            free(s->cache);
+    }
+    free(s->term);
+    free(s);
+    return ret;
+}
@@ -0,0 +1,42 @@
+#ifndef CONGIF_CONGIF_H
+#define CONGIF_CONGIF_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Conversion of a terminal session to a GIF, fed one timing line at a
+ * time. Sessions share no state, so any number of them can be converted
+ * at once, each from one thread. The GIF is handed out block by block to
+ * a write function, as in gif.h. */
+
+typedef struct Config {
+    int rows, cols;
+    struct Font *font;  /* NULL for the built-in font, see load_font() */
+    uint8_t plt[0x30];  /* default palette, 16 colours as RGB */
+    int64_t maxdelay;   /* longest delay, in microseconds */
+    float divisor;      /* speedup */
+    int loop;           /* GIF loop count, -1 for none */
+    int cursor;         /* show the cursor */
+    int rects;          /* maximum number of images per frame */
+    int fps;            /* frames per second, 0 to follow the timings */
+    int64_t start, end; /* window, in microseconds of the timings, 0 for none */
+    int async;          /* write the GIF from a background thread */
+    int threads;        /* encoding threads, 0 to encode inline */
+    int bands;          /* split large images into bands */
+    int verbose;        /* log unsupported sequences to stderr */
+    int flush;          /* write out each frame as soon as it can be */
+} Config;
+
+/* Playback of a session, only seen through the functions below. */
+typedef struct Session Session;
+
+void default_config(Config *cfg);
+Session *new_session(const Config *cfg,
+                     int (*write)(void *arg, const uint8_t *data, size_t len),
+                     void *arg);
+long time_session(Session *s, int64_t us);
+void feed_session(Session *s, const uint8_t *data, size_t len);
+long push_session(Session *s, int64_t us, const uint8_t *data, size_t len);
+int close_session(Session *s);
+
+#endif
@@ -96,7 +96,6 @@ static uint8_t plt_putty[0x30] = {
 #define DEF_FORE    0x7
 #define DEF_BACK    0x0
 
-static uint8_t * def_plt = plt_xterm;
 static uint16_t def_mode = M_AUTOWRAP | M_AUTORPT | M_CURSORVIS;
 static uint8_t def_attr = A_NORMAL;
 static uint8_t def_pair = (DEF_FORE << 4) | DEF_BACK;
@@ -0,0 +1,1514 @@
+static Range default_font_ranges[176] = {
+    { 0, 1 },
+    { 32, 95 },
+    { 160, 224 },
+    { 399, 1 },
+    { 402, 1 },
+    { 416, 2 },
+    { 431, 2 },
+    { 437, 2 },
+    { 465, 2 },
+    { 486, 2 },
+    { 506, 6 },
+    { 536, 4 },
+    { 601, 1 },
+    { 700, 2 },
+    { 710, 2 },
+    { 713, 1 },
+    { 726, 1 },
+    { 728, 6 },
+    { 768, 18 },
+    { 803, 2 },
+    { 824, 1 },
+    { 832, 2 },
+    { 884, 2 },
+    { 890, 1 },
+    { 894, 1 },
+    { 900, 7 },
+    { 908, 1 },
+    { 910, 20 },
+    { 931, 44 },
+    { 976, 8 },
+    { 986, 8 },
+    { 1008, 6 },
+    { 1025, 12 },
+    { 1038, 66 },
+    { 1105, 12 },
+    { 1118, 2 },
+    { 1122, 2 },
+    { 1136, 8 },
+    { 1168, 4 },
+    { 1174, 2 },
+    { 1178, 2 },
+    { 1198, 6 },
+    { 1210, 2 },
+    { 1240, 2 },
+    { 1250, 2 },
+    { 1256, 2 },
+    { 1262, 2 },
+    { 1488, 27 },
+    { 5792, 1 },
+    { 5794, 2 },
+    { 5798, 1 },
+    { 5801, 4 },
+    { 5809, 1 },
+    { 5811, 1 },
+    { 5815, 3 },
+    { 5819, 1 },
+    { 5822, 1 },
+    { 5825, 1 },
+    { 5828, 1 },
+    { 5831, 3 },
+    { 5835, 1 },
+    { 5839, 1 },
+    { 5842, 1 },
+    { 5846, 2 },
+    { 5850, 1 },
+    { 5853, 7 },
+    { 5861, 1 },
+    { 5867, 3 },
+    { 7682, 3 },
+    { 7690, 2 },
+    { 7710, 2 },
+    { 7744, 2 },
+    { 7766, 2 },
+    { 7776, 2 },
+    { 7786, 2 },
+    { 7808, 6 },
+    { 7922, 2 },
+    { 7936, 22 },
+    { 7960, 6 },
+    { 7968, 38 },
+    { 8008, 6 },
+    { 8016, 8 },
+    { 8025, 1 },
+    { 8027, 1 },
+    { 8029, 1 },
+    { 8031, 31 },
+    { 8064, 53 },
+    { 8118, 15 },
+    { 8134, 14 },
+    { 8150, 6 },
+    { 8157, 19 },
+    { 8178, 3 },
+    { 8182, 9 },
+    { 8208, 24 },
+    { 8240, 1 },
+    { 8242, 6 },
+    { 8249, 2 },
+    { 8252, 1 },
+    { 8254, 1 },
+    { 8260, 1 },
+    { 8304, 2 },
+    { 8308, 27 },
+    { 8355, 2 },
+    { 8359, 1 },
+    { 8363, 2 },
+    { 8367, 1 },
+    { 8400, 8 },
+    { 8450, 1 },
+    { 8453, 1 },
+    { 8467, 1 },
+    { 8469, 2 },
+    { 8474, 1 },
+    { 8477, 1 },
+    { 8482, 1 },
+    { 8484, 1 },
+    { 8486, 2 },
+    { 8494, 1 },
+    { 8539, 4 },
+    { 8592, 10 },
+    { 8612, 5 },
+    { 8644, 1 },
+    { 8646, 1 },
+    { 8651, 2 },
+    { 8656, 6 },
+    { 8704, 10 },
+    { 8715, 2 },
+    { 8719, 1 },
+    { 8721, 3 },
+    { 8725, 1 },
+    { 8728, 3 },
+    { 8733, 3 },
+    { 8737, 1 },
+    { 8740, 8 },
+    { 8750, 1 },
+    { 8764, 1 },
+    { 8771, 1 },
+    { 8773, 1 },
+    { 8776, 2 },
+    { 8793, 1 },
+    { 8799, 4 },
+    { 8804, 2 },
+    { 8810, 2 },
+    { 8834, 10 },
+    { 8853, 1 },
+    { 8855, 1 },
+    { 8868, 4 },
+    { 8896, 4 },
+    { 8901, 1 },
+    { 8942, 4 },
+    { 8960, 1 },
+    { 8962, 1 },
+    { 8968, 4 },
+    { 8976, 1 },
+    { 8992, 2 },
+    { 9146, 4 },
+    { 9225, 5 },
+    { 9252, 1 },
+    { 9472, 162 },
+    { 9642, 3 },
+    { 9646, 1 },
+    { 9650, 2 },
+    { 9658, 4 },
+    { 9668, 3 },
+    { 9674, 3 },
+    { 9679, 1 },
+    { 9688, 2 },
+    { 9702, 1 },
+    { 9728, 1 },
+    { 9786, 3 },
+    { 9791, 4 },
+    { 9824, 7 },
+    { 9834, 6 },
+    { 10216, 2 },
+    { 10240, 256 },
+    { 64257, 2 },
+    { 65533, 1 }
+};
+
+static uint8_t default_font_data[] = {
+    0x00, 0xa8, 0x00, 0x88, 0x00, 0x88, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0xf8, 0x50, 0xf8, 0x50, 0x50,
+    0x00, 0x00, 0x00, 0x20, 0x70, 0xa0, 0x70, 0x28, 0x70, 0x20, 0x00, 0x00,
+    0x00, 0x48, 0xa8, 0x50, 0x20, 0x50, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x40,
+    0xa0, 0xa0, 0x40, 0xa8, 0x90, 0x68, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x40, 0x40,
+    0x20, 0x10, 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x10, 0x10, 0x20, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x88, 0x50, 0xf8, 0x50, 0x88, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x70, 0x20, 0x00, 0x00, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00, 0x00,
+    0x00, 0x20, 0x60, 0xa0, 0x20, 0x20, 0x20, 0xf8, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x08, 0x30, 0x40, 0x80, 0xf8, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x10,
+    0x30, 0x08, 0x88, 0x70, 0x00, 0x00, 0x00, 0x10, 0x30, 0x50, 0x90, 0xf8,
+    0x10, 0x10, 0x00, 0x00, 0x00, 0xf8, 0x80, 0xb0, 0xc8, 0x08, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x30, 0x40, 0x80, 0xb0, 0xc8, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0xf8, 0x08, 0x10, 0x10, 0x20, 0x40, 0x40, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x88, 0x70, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x70, 0x88, 0x98,
+    0x68, 0x08, 0x10, 0x60, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0x20, 0x00,
+    0x20, 0x70, 0x20, 0x00, 0x00, 0x00, 0x20, 0x70, 0x20, 0x00, 0x30, 0x20,
+    0x40, 0x00, 0x00, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00, 0x70, 0x88, 0x10,
+    0x20, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70, 0x88, 0x98, 0xa8, 0xb0,
+    0x80, 0x70, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x88, 0xf8, 0x88, 0x88,
+    0x00, 0x00, 0x00, 0xf0, 0x48, 0x48, 0x70, 0x48, 0x48, 0xf0, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00, 0x00, 0x00, 0xf0,
+    0x48, 0x48, 0x48, 0x48, 0x48, 0xf0, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x80,
+    0xf0, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x80, 0xf0, 0x80,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x80, 0x98, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x88, 0x00, 0x00,
+    0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x38,
+    0x10, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00, 0x00, 0x00, 0x88, 0x90, 0xa0,
+    0xc0, 0xa0, 0x90, 0x88, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xf8, 0x00, 0x00, 0x00, 0x88, 0x88, 0xd8, 0xa8, 0x88, 0x88, 0x88,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0xc8, 0xa8, 0x98, 0x88, 0x88, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0xf0,
+    0x88, 0x88, 0xf0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88,
+    0x88, 0x88, 0xa8, 0x70, 0x08, 0x00, 0x00, 0xf0, 0x88, 0x88, 0xf0, 0xa0,
+    0x90, 0x88, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x88, 0x50, 0x50, 0x50, 0x20, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88,
+    0xa8, 0xa8, 0xd8, 0x88, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x20, 0x50,
+    0x88, 0x88, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0xf8, 0x08, 0x10, 0x20, 0x40, 0x80, 0xf8, 0x00, 0x00,
+    0x00, 0x70, 0x40, 0x40, 0x40, 0x40, 0x40, 0x70, 0x00, 0x00, 0x00, 0x80,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x08, 0x00, 0x00, 0x00, 0x70, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x70, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x00, 0x00, 0x00, 0x80,
+    0x80, 0xb0, 0xc8, 0x88, 0xc8, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x80, 0x88, 0x70, 0x00, 0x00, 0x00, 0x08, 0x08, 0x68, 0x98, 0x88,
+    0x98, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x70,
+    0x00, 0x00, 0x00, 0x30, 0x48, 0x40, 0xf0, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x88, 0x88, 0x78, 0x08, 0x88, 0x70, 0x00, 0x80,
+    0x80, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x20, 0x00, 0x60,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x08, 0x08,
+    0x08, 0x48, 0x48, 0x30, 0x00, 0x80, 0x80, 0x88, 0x90, 0xe0, 0x90, 0x88,
+    0x00, 0x00, 0x00, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd0, 0xa8, 0xa8, 0xa8, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xc8, 0x88,
+    0xc8, 0xb0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x68, 0x98, 0x88, 0x98, 0x68,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0xb0, 0xc8, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x80, 0x70, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0xf0, 0x40, 0x40, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50,
+    0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xa8, 0xa8, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x98, 0x68, 0x08, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0xf8, 0x10, 0x20, 0x40, 0xf8, 0x00, 0x00, 0x00, 0x18, 0x20, 0x10,
+    0x60, 0x10, 0x20, 0x18, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x60, 0x10, 0x20, 0x18, 0x20, 0x10, 0x60,
+    0x00, 0x00, 0x00, 0x48, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x78,
+    0xa0, 0xa0, 0xa0, 0x78, 0x20, 0x00, 0x00, 0x30, 0x48, 0x40, 0xe0, 0x40,
+    0x48, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x70, 0x50, 0x70, 0x88,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x20, 0xf8, 0x20, 0x20, 0x20, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x70,
+    0x80, 0xe0, 0x90, 0x48, 0x38, 0x08, 0x70, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0xa8, 0xc8, 0xa8,
+    0x88, 0x70, 0x00, 0x00, 0x00, 0x38, 0x48, 0x58, 0x28, 0x00, 0x78, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x48, 0x90, 0x48, 0x24, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0xe8,
+    0xc8, 0xc8, 0x88, 0x70, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0xf8, 0x00, 0x00,
+    0x30, 0x48, 0x10, 0x20, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x08,
+    0x30, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88,
+    0xc8, 0xb0, 0x80, 0x00, 0x00, 0x78, 0xe8, 0xe8, 0x68, 0x28, 0x28, 0x28,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x20, 0x60,
+    0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x48,
+    0x30, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x48, 0x24,
+    0x48, 0x90, 0x00, 0x00, 0x40, 0xc0, 0x40, 0x40, 0xe4, 0x0c, 0x14, 0x3c,
+    0x04, 0x00, 0x40, 0xc0, 0x40, 0x40, 0xe8, 0x14, 0x04, 0x08, 0x1c, 0x00,
+    0xc0, 0x20, 0x40, 0x20, 0xc8, 0x18, 0x28, 0x78, 0x08, 0x00, 0x00, 0x20,
+    0x00, 0x20, 0x20, 0x40, 0x88, 0x70, 0x00, 0x00, 0x40, 0x20, 0x70, 0x88,
+    0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x10, 0x20, 0x70, 0x88, 0x88, 0xf8,
+    0x88, 0x88, 0x00, 0x00, 0x20, 0x50, 0x70, 0x88, 0x88, 0xf8, 0x88, 0x88,
+    0x00, 0x00, 0x48, 0xb0, 0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x00, 0x00,
+    0x50, 0x00, 0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x20, 0x50,
+    0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x00, 0x3c, 0x50, 0x90,
+    0x9c, 0xf0, 0x90, 0x9c, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x80, 0x80,
+    0x88, 0x70, 0x20, 0x40, 0x40, 0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0xf8,
+    0x00, 0x00, 0x10, 0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0xf8, 0x00, 0x00,
+    0x20, 0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x50, 0xf8,
+    0x80, 0x80, 0xf0, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x40, 0x20, 0x70, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x10, 0x20, 0x70, 0x20, 0x20, 0x20,
+    0x20, 0x70, 0x00, 0x00, 0x20, 0x50, 0x70, 0x20, 0x20, 0x20, 0x20, 0x70,
+    0x00, 0x00, 0x50, 0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    0x00, 0xf0, 0x48, 0x48, 0xe8, 0x48, 0x48, 0xf0, 0x00, 0x00, 0x28, 0x50,
+    0x88, 0xc8, 0xa8, 0x98, 0x88, 0x88, 0x00, 0x00, 0x40, 0x20, 0x70, 0x88,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20, 0x70, 0x88, 0x88, 0x88,
+    0x88, 0x70, 0x00, 0x00, 0x20, 0x50, 0x70, 0x88, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x28, 0x50, 0x70, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x50, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x70, 0x98, 0x98,
+    0xa8, 0xc8, 0xc8, 0x70, 0x00, 0x00, 0x40, 0x20, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x70, 0x00, 0x00, 0x10, 0x20, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x20, 0x50, 0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x50, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20,
+    0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x80, 0xf0, 0x88,
+    0xf0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x70, 0x88, 0x90, 0xa0, 0x90,
+    0x88, 0xb0, 0x00, 0x00, 0x40, 0x20, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78,
+    0x00, 0x00, 0x10, 0x20, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x00, 0x00,
+    0x20, 0x50, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x00, 0x00, 0x28, 0x50,
+    0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x00, 0x00, 0x00, 0x50, 0x00, 0x70,
+    0x08, 0x78, 0x88, 0x78, 0x00, 0x00, 0x20, 0x50, 0x20, 0x70, 0x08, 0x78,
+    0x88, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x14, 0x7c, 0x90, 0x7c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x20, 0x40,
+    0x40, 0x20, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x00, 0x00, 0x10, 0x20,
+    0x00, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x00, 0x00, 0x20, 0x50, 0x00, 0x70,
+    0x88, 0xf8, 0x80, 0x70, 0x00, 0x00, 0x00, 0x50, 0x00, 0x70, 0x88, 0xf8,
+    0x80, 0x70, 0x00, 0x00, 0x40, 0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70,
+    0x00, 0x00, 0x20, 0x40, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    0x20, 0x50, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x70,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x28, 0x50, 0x00, 0xb0, 0xc8, 0x88,
+    0x88, 0x88, 0x00, 0x00, 0x40, 0x20, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x10, 0x20, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x20, 0x50, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x28, 0x50,
+    0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x50, 0x00, 0x70,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xf8, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x98, 0xa8, 0xc8, 0xf0,
+    0x00, 0x00, 0x40, 0x20, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00,
+    0x10, 0x20, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x20, 0x50,
+    0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x00, 0x50, 0x00, 0x88,
+    0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x00, 0x10, 0x20, 0x88, 0x88, 0x98,
+    0x68, 0x08, 0x88, 0x70, 0x00, 0x00, 0x80, 0xf0, 0x88, 0x88, 0x88, 0xf0,
+    0x80, 0x80, 0x00, 0x50, 0x00, 0x88, 0x88, 0x98, 0x68, 0x08, 0x88, 0x70,
+    0x70, 0x00, 0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x00, 0x70,
+    0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x00, 0x00, 0x88, 0x70, 0x70, 0x88,
+    0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x88, 0x70, 0x00, 0x70, 0x08, 0x78,
+    0x88, 0x78, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x88, 0xf8, 0x88, 0x88,
+    0x10, 0x18, 0x00, 0x00, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x10, 0x18,
+    0x10, 0x20, 0x70, 0x88, 0x80, 0x80, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20,
+    0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x00, 0x00, 0x20, 0x50, 0x70, 0x88,
+    0x80, 0x80, 0x88, 0x70, 0x00, 0x00, 0x20, 0x50, 0x00, 0x70, 0x88, 0x80,
+    0x88, 0x70, 0x00, 0x00, 0x20, 0x00, 0x70, 0x88, 0x80, 0x80, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x00, 0x00,
+    0x50, 0x20, 0x70, 0x88, 0x80, 0x80, 0x88, 0x70, 0x00, 0x00, 0x50, 0x20,
+    0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x00, 0x00, 0x50, 0x20, 0xf0, 0x88,
+    0x88, 0x88, 0x88, 0xf0, 0x00, 0x00, 0x50, 0x20, 0x08, 0x68, 0x98, 0x88,
+    0x98, 0x68, 0x00, 0x00, 0x00, 0x78, 0x44, 0x44, 0xe4, 0x44, 0x44, 0x78,
+    0x00, 0x00, 0x00, 0x10, 0x38, 0x10, 0x70, 0x90, 0x90, 0x70, 0x00, 0x00,
+    0x70, 0x00, 0xf8, 0x80, 0xf0, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x00, 0x70,
+    0x00, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x00, 0x00, 0x88, 0x70, 0xf8, 0x80,
+    0xf0, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x88, 0x70, 0x00, 0x70, 0x88, 0xf8,
+    0x80, 0x70, 0x00, 0x00, 0x20, 0x00, 0xf8, 0x80, 0xf0, 0x80, 0x80, 0xf8,
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x00, 0x00,
+    0x00, 0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0xf8, 0x20, 0x30, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x20, 0x30, 0x50, 0x20, 0xf8, 0x80,
+    0xf0, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x50, 0x20, 0x00, 0x70, 0x88, 0xf8,
+    0x80, 0x70, 0x00, 0x00, 0x20, 0x50, 0x70, 0x88, 0x80, 0x98, 0x88, 0x70,
+    0x00, 0x00, 0x20, 0x50, 0x00, 0x68, 0x90, 0x60, 0x80, 0x70, 0x88, 0x70,
+    0x88, 0x70, 0x70, 0x88, 0x80, 0x98, 0x88, 0x70, 0x00, 0x00, 0x88, 0x70,
+    0x00, 0x68, 0x90, 0x60, 0x80, 0x70, 0x88, 0x70, 0x20, 0x00, 0x70, 0x88,
+    0x80, 0x98, 0x88, 0x70, 0x00, 0x00, 0x00, 0x20, 0x00, 0x68, 0x90, 0x60,
+    0x80, 0x70, 0x88, 0x70, 0x00, 0x00, 0x70, 0x88, 0x80, 0x98, 0x88, 0x70,
+    0x20, 0x40, 0x40, 0x60, 0x00, 0x68, 0x90, 0x60, 0x80, 0x70, 0x88, 0x70,
+    0x20, 0x50, 0x00, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x10, 0x28,
+    0x80, 0x80, 0xf0, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x48, 0xfc, 0x48,
+    0x78, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x40, 0xe0, 0x58, 0x64, 0x44,
+    0x44, 0x44, 0x00, 0x00, 0x28, 0x50, 0x70, 0x20, 0x20, 0x20, 0x20, 0x70,
+    0x00, 0x00, 0x28, 0x50, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00,
+    0x70, 0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x70,
+    0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x88, 0x70, 0x70, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x88, 0x70, 0x00, 0x60, 0x20, 0x20,
+    0x20, 0x70, 0x00, 0x00, 0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+    0x20, 0x30, 0x00, 0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x20, 0x30,
+    0x20, 0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0xb8, 0x88, 0x88,
+    0x88, 0x88, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x48, 0x00, 0x58, 0x48, 0x48,
+    0x48, 0x48, 0x08, 0x30, 0x10, 0x28, 0x38, 0x10, 0x10, 0x10, 0x90, 0x60,
+    0x00, 0x00, 0x10, 0x28, 0x00, 0x30, 0x10, 0x10, 0x10, 0x90, 0x90, 0x60,
+    0x00, 0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x88, 0x20, 0x60, 0x00, 0x80,
+    0x80, 0x88, 0x90, 0xe0, 0x90, 0x88, 0x20, 0x60, 0x00, 0x00, 0x00, 0x88,
+    0x90, 0xe0, 0x90, 0x88, 0x00, 0x00, 0x10, 0xa0, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xf8, 0x00, 0x00, 0x10, 0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70,
+    0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xf8, 0x20, 0x60,
+    0x00, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x60, 0x28, 0x90,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x50, 0x20, 0x60, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x80, 0x80, 0xa0, 0x80, 0x80,
+    0x80, 0xf8, 0x00, 0x00, 0x00, 0x60, 0x20, 0x28, 0x20, 0x20, 0x20, 0x70,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x60, 0xc0, 0x40, 0x40, 0x7c, 0x00, 0x00,
+    0x00, 0x60, 0x20, 0x30, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00, 0x10, 0x20,
+    0x88, 0xc8, 0xa8, 0x98, 0x88, 0x88, 0x00, 0x00, 0x10, 0x20, 0x00, 0xb0,
+    0xc8, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x88, 0x88, 0xc8, 0xa8, 0x98,
+    0x88, 0x88, 0x20, 0x40, 0x00, 0x00, 0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88,
+    0x20, 0x40, 0x50, 0x20, 0x88, 0xc8, 0xa8, 0x98, 0x88, 0x88, 0x00, 0x00,
+    0x50, 0x20, 0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x00, 0x00, 0xc0, 0x40,
+    0x80, 0x28, 0x34, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x88, 0x88, 0xc8,
+    0xa8, 0x98, 0x88, 0x88, 0x08, 0x30, 0x00, 0x00, 0x00, 0xb0, 0xc8, 0x88,
+    0x88, 0x88, 0x08, 0x30, 0x70, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x88, 0x70, 0x70, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x88, 0x70,
+    0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x48, 0x90, 0x70, 0x88,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x48, 0x90, 0x00, 0x70, 0x88, 0x88,
+    0x88, 0x70, 0x00, 0x00, 0x00, 0x78, 0xa0, 0xa0, 0xb0, 0xa0, 0xa0, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xa8, 0xb0, 0xa0, 0x78, 0x00, 0x00,
+    0x10, 0x20, 0xf0, 0x88, 0xf0, 0xa0, 0x90, 0x88, 0x00, 0x00, 0x10, 0x20,
+    0x00, 0xb0, 0xc8, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x78, 0x44, 0x44,
+    0x78, 0x50, 0x48, 0x44, 0x20, 0xc0, 0x00, 0x00, 0x00, 0x58, 0x64, 0x40,
+    0x40, 0x40, 0x20, 0xc0, 0x50, 0x20, 0xf0, 0x88, 0xf0, 0xa0, 0x90, 0x88,
+    0x00, 0x00, 0x50, 0x20, 0x00, 0xb0, 0xc8, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x10, 0x20, 0x78, 0x80, 0x70, 0x08, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20,
+    0x00, 0x70, 0x80, 0x70, 0x08, 0xf0, 0x00, 0x00, 0x20, 0x50, 0x78, 0x80,
+    0x70, 0x08, 0x88, 0x70, 0x00, 0x00, 0x20, 0x50, 0x00, 0x70, 0x80, 0x70,
+    0x08, 0xf0, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70,
+    0x20, 0x40, 0x00, 0x00, 0x00, 0x70, 0x80, 0x70, 0x08, 0xf0, 0x20, 0x40,
+    0x50, 0x20, 0x70, 0x80, 0x70, 0x08, 0x88, 0x70, 0x00, 0x00, 0x50, 0x20,
+    0x00, 0x70, 0x80, 0x70, 0x08, 0xf0, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x10, 0x60, 0x00, 0x40, 0x40, 0xf0, 0x40, 0x40,
+    0x48, 0x30, 0x10, 0x60, 0x50, 0x20, 0xf8, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0xa0, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0xf8, 0x20, 0x20, 0x70, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x40,
+    0xf0, 0x40, 0xf0, 0x40, 0x48, 0x30, 0x00, 0x00, 0x28, 0x50, 0x00, 0x88,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x28, 0x50, 0x00, 0x88, 0x88, 0x88,
+    0x98, 0x68, 0x00, 0x00, 0x70, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x70, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00,
+    0x88, 0x70, 0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x88, 0x70,
+    0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x20, 0x50, 0xa8, 0x88,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x20, 0x50, 0x20, 0x88, 0x88, 0x88,
+    0x98, 0x68, 0x00, 0x00, 0x48, 0x90, 0x00, 0x88, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x48, 0x90, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x20, 0x30, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x10, 0x18, 0x20, 0x50, 0x00, 0x88,
+    0xa8, 0xa8, 0xd8, 0x88, 0x00, 0x00, 0x20, 0x50, 0x00, 0x88, 0x88, 0xa8,
+    0xa8, 0x50, 0x00, 0x00, 0x20, 0x50, 0x00, 0x88, 0x50, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x50, 0x00, 0x88, 0x88, 0x98, 0x68, 0x08, 0x88, 0x70,
+    0x50, 0x00, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x10, 0x20,
+    0xf8, 0x10, 0x20, 0x40, 0x80, 0xf8, 0x00, 0x00, 0x10, 0x20, 0x00, 0xf8,
+    0x10, 0x20, 0x40, 0xf8, 0x00, 0x00, 0x20, 0x00, 0xf8, 0x10, 0x20, 0x40,
+    0x80, 0xf8, 0x00, 0x00, 0x00, 0x20, 0x00, 0xf8, 0x10, 0x20, 0x40, 0xf8,
+    0x00, 0x00, 0x50, 0x20, 0xf8, 0x10, 0x20, 0x40, 0x80, 0xf8, 0x00, 0x00,
+    0x50, 0x20, 0x00, 0xf8, 0x10, 0x20, 0x40, 0xf8, 0x00, 0x00, 0x00, 0x30,
+    0x48, 0x40, 0xc0, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x70, 0x88, 0x08,
+    0xf8, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x10, 0x28, 0x20, 0x70, 0x20,
+    0x20, 0xa0, 0x40, 0x00, 0x00, 0x64, 0x94, 0x98, 0x90, 0x90, 0x90, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x98, 0x90, 0x90, 0x60, 0x00, 0x00,
+    0x00, 0x94, 0x94, 0x98, 0x90, 0x90, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x94, 0x98, 0x90, 0xb0, 0x50, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x10,
+    0xf8, 0x40, 0x80, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x10, 0xf8,
+    0x40, 0xf8, 0x00, 0x00, 0x50, 0x20, 0x70, 0x88, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x50, 0x20, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x50, 0x20, 0x70, 0x88, 0x80, 0x98, 0x88, 0x70, 0x00, 0x00, 0x50, 0x20,
+    0x00, 0x68, 0x90, 0x60, 0x80, 0x70, 0x88, 0x70, 0x10, 0x20, 0x20, 0x50,
+    0x70, 0x88, 0xf8, 0x88, 0x00, 0x00, 0x10, 0x20, 0x20, 0x50, 0x20, 0x78,
+    0x88, 0x78, 0x00, 0x00, 0x08, 0x10, 0x7c, 0x90, 0x9c, 0xf0, 0x90, 0x9c,
+    0x00, 0x00, 0x08, 0x10, 0x00, 0x78, 0x14, 0x7c, 0x90, 0x7c, 0x00, 0x00,
+    0x10, 0x20, 0x70, 0x98, 0xa8, 0xa8, 0xc8, 0x70, 0x00, 0x00, 0x10, 0x20,
+    0x00, 0x78, 0x98, 0xa8, 0xc8, 0xf0, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80,
+    0x70, 0x08, 0x88, 0x70, 0x20, 0x40, 0x00, 0x00, 0x00, 0x70, 0x80, 0x70,
+    0x08, 0xf0, 0x20, 0x40, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x10, 0x20, 0x00, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x48, 0x30, 0x10, 0x20,
+    0x00, 0x00, 0x00, 0x70, 0x08, 0xf8, 0x88, 0x70, 0x00, 0x00, 0x00, 0x30,
+    0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x30, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x48, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x90, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xa8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x10, 0x10, 0x20, 0x20,
+    0x40, 0x40, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x00, 0x20, 0x70, 0x20, 0x00,
+    0x30, 0x20, 0x40, 0x00, 0x00, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x58, 0xa4, 0x24, 0x24, 0x3c, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xa0, 0x20,
+    0x38, 0x20, 0x20, 0x3c, 0x00, 0x00, 0x00, 0x64, 0xa4, 0x24, 0x3c, 0x24,
+    0x24, 0x24, 0x00, 0x00, 0x00, 0x5c, 0x88, 0x08, 0x08, 0x08, 0x08, 0x1c,
+    0x00, 0x00, 0x00, 0x58, 0xa4, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00,
+    0x00, 0x54, 0x94, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x58,
+    0xa4, 0x24, 0x24, 0x24, 0x18, 0x3c, 0x00, 0x00, 0x10, 0xa8, 0x00, 0x20,
+    0x20, 0x20, 0x28, 0x10, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x88, 0xf8,
+    0x88, 0x88, 0x00, 0x00, 0x00, 0xf0, 0x88, 0x88, 0xf0, 0x88, 0x88, 0xf0,
+    0x00, 0x00, 0x00, 0xf8, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x00, 0x20, 0x50, 0x50, 0x50, 0x88, 0x88, 0xf8, 0x00, 0x00, 0x00, 0xf8,
+    0x80, 0x80, 0xf0, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x00, 0xf8, 0x08, 0x10,
+    0x20, 0x40, 0x80, 0xf8, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0xf8, 0x88,
+    0x88, 0x88, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    0x00, 0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x88, 0x00, 0x00, 0x00, 0x20,
+    0x50, 0x50, 0x50, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x88, 0x88, 0xd8,
+    0xa8, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x88, 0x88, 0xc8, 0xa8, 0x98,
+    0x88, 0x88, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x70, 0x00, 0x00, 0xf8,
+    0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0xf8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0xf0,
+    0x88, 0x88, 0xf0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0xf8, 0x80, 0x40,
+    0x20, 0x40, 0x80, 0xf8, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x70, 0xa8, 0xa8, 0xa8, 0x70, 0x20, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x00, 0x00, 0x00, 0xa8,
+    0xa8, 0xa8, 0xa8, 0x70, 0x20, 0x20, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88,
+    0x88, 0x88, 0x50, 0xd8, 0x00, 0x00, 0x50, 0x00, 0x70, 0x20, 0x20, 0x20,
+    0x20, 0x70, 0x00, 0x00, 0x88, 0x00, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x10, 0x20, 0x00, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00,
+    0x10, 0x20, 0x00, 0x70, 0x88, 0x60, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20,
+    0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x08, 0x20, 0x40, 0x00, 0x40,
+    0x40, 0x40, 0x50, 0x20, 0x00, 0x00, 0x10, 0xa8, 0x00, 0x88, 0x88, 0x88,
+    0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0x98, 0x68,
+    0x00, 0x00, 0x00, 0x60, 0x90, 0x90, 0xf0, 0x88, 0x88, 0xf0, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x50, 0x20, 0x20, 0x20, 0x00, 0x70,
+    0x88, 0x60, 0x90, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x60, 0x88, 0x70, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x40, 0x40, 0x80,
+    0x80, 0x70, 0x08, 0x30, 0x00, 0x00, 0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88,
+    0x08, 0x08, 0x00, 0x30, 0x48, 0x48, 0x78, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x90, 0xe0, 0x90, 0x88, 0x00, 0x00, 0x00, 0x70, 0x88, 0x68,
+    0x98, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88,
+    0xd8, 0xa8, 0x80, 0x80, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x50, 0x20,
+    0x00, 0x00, 0x00, 0xf8, 0x20, 0x40, 0x30, 0x40, 0x80, 0x70, 0x08, 0x30,
+    0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x88, 0x88, 0xf0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80,
+    0x80, 0x70, 0x08, 0x30, 0x00, 0x00, 0x00, 0x78, 0x90, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xa8, 0xa8, 0xa8, 0x70, 0x20, 0x20, 0x00, 0x00, 0x00, 0x88,
+    0x50, 0x50, 0x20, 0x50, 0x50, 0x88, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8,
+    0xa8, 0x70, 0x20, 0x20, 0x00, 0x00, 0x00, 0x88, 0xa8, 0xa8, 0xa8, 0x50,
+    0x00, 0x00, 0x00, 0x88, 0x00, 0x20, 0x20, 0x20, 0x28, 0x10, 0x00, 0x00,
+    0x00, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20,
+    0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20, 0x00, 0x88,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20, 0x00, 0x88, 0xa8, 0xa8,
+    0xa8, 0x50, 0x00, 0x00, 0x00, 0x60, 0x90, 0xa0, 0xf0, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x60, 0x90, 0x78, 0x10, 0x90, 0x90, 0x60, 0x00, 0x00,
+    0x00, 0x50, 0xa8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x50,
+    0xa8, 0x20, 0xa0, 0xa0, 0x20, 0x20, 0x00, 0x00, 0x88, 0x00, 0x50, 0xa8,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x70, 0xa8, 0xa8,
+    0xa8, 0x70, 0x20, 0x20, 0x00, 0x00, 0x00, 0xf8, 0x88, 0xa8, 0xa8, 0x50,
+    0x00, 0x00, 0x00, 0x10, 0x20, 0x88, 0x50, 0x60, 0x60, 0x98, 0x08, 0x70,
+    0x00, 0x30, 0x48, 0x80, 0x80, 0x80, 0x70, 0x08, 0x10, 0x00, 0x00, 0x00,
+    0x08, 0x70, 0x80, 0x80, 0x80, 0x70, 0x08, 0x30, 0x00, 0xf8, 0x80, 0x80,
+    0xf0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0x40,
+    0x70, 0x40, 0x40, 0x40, 0x00, 0x80, 0x88, 0x98, 0xa8, 0xc8, 0x88, 0x08,
+    0x00, 0x00, 0x00, 0x20, 0x40, 0x40, 0x80, 0xf8, 0x08, 0x10, 0x10, 0x20,
+    0x00, 0x20, 0x50, 0x50, 0x50, 0x98, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0xc0,
+    0x20, 0x10, 0x30, 0x58, 0x28, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x88,
+    0x50, 0x60, 0x60, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88,
+    0x88, 0xf0, 0x80, 0x70, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x08, 0x08, 0x08, 0x48, 0x48, 0x30,
+    0x00, 0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x40, 0x70, 0x40, 0x38, 0x00, 0x00, 0x50, 0x00, 0xf8, 0x80,
+    0xf0, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x00, 0xe0, 0x40, 0x40, 0x70, 0x48,
+    0x48, 0x48, 0x08, 0x30, 0x10, 0x20, 0xf8, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0xe0, 0x80, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70, 0x00, 0x00, 0x00, 0x70,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x50, 0x00, 0x70, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x38, 0x08, 0x08, 0x08, 0x08,
+    0x88, 0x70, 0x00, 0x00, 0x00, 0x30, 0x50, 0x50, 0x98, 0x94, 0x94, 0x98,
+    0x00, 0x00, 0x00, 0xa0, 0xa0, 0xa0, 0xf0, 0xa8, 0xa8, 0xb0, 0x00, 0x00,
+    0x00, 0xe0, 0x40, 0x40, 0x70, 0x48, 0x48, 0x48, 0x00, 0x00, 0x10, 0x20,
+    0x88, 0x90, 0xe0, 0x90, 0x88, 0x88, 0x00, 0x00, 0x50, 0x20, 0x88, 0x88,
+    0x50, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0xf8, 0x20, 0x00, 0x00, 0x20, 0x50, 0x88, 0x88, 0xf8, 0x88, 0x88,
+    0x00, 0x00, 0x00, 0xf0, 0x80, 0x80, 0xf0, 0x88, 0x88, 0xf0, 0x00, 0x00,
+    0x00, 0xf0, 0x88, 0x88, 0xf0, 0x88, 0x88, 0xf0, 0x00, 0x00, 0x00, 0xf8,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x18, 0x28, 0x28,
+    0x48, 0x48, 0x48, 0xf8, 0x88, 0x00, 0x00, 0xf8, 0x80, 0x80, 0xf0, 0x80,
+    0x80, 0xf8, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0x70, 0xa8, 0xa8, 0xa8,
+    0x00, 0x00, 0x00, 0x70, 0x88, 0x08, 0x30, 0x08, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x98, 0xa8, 0xc8, 0x88, 0x88, 0x00, 0x00, 0x50, 0x20,
+    0x88, 0x98, 0xa8, 0xc8, 0x88, 0x88, 0x00, 0x00, 0x00, 0x88, 0x90, 0xa0,
+    0xc0, 0xa0, 0x90, 0x88, 0x00, 0x00, 0x00, 0x38, 0x48, 0x48, 0x48, 0x48,
+    0x48, 0x88, 0x00, 0x00, 0x00, 0x88, 0x88, 0xd8, 0xa8, 0x88, 0x88, 0x88,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x88, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0xf8,
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0xf0, 0x88, 0x88,
+    0xf0, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x80, 0x80,
+    0x88, 0x70, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x20, 0x40, 0x80, 0x00, 0x00,
+    0x00, 0x20, 0x70, 0xa8, 0xa8, 0xa8, 0x70, 0x20, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x00, 0x00, 0x00, 0x90, 0x90, 0x90,
+    0x90, 0x90, 0x90, 0xf8, 0x08, 0x08, 0x00, 0x88, 0x88, 0x88, 0x78, 0x08,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xf8,
+    0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0xf8, 0x08, 0x08,
+    0x00, 0xc0, 0x40, 0x40, 0x70, 0x48, 0x48, 0x70, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x88, 0xe8, 0x98, 0x98, 0xe8, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40,
+    0x70, 0x48, 0x48, 0x70, 0x00, 0x00, 0x00, 0x70, 0x88, 0x08, 0x38, 0x08,
+    0x88, 0x70, 0x00, 0x00, 0x00, 0x90, 0xa8, 0xa8, 0xe8, 0xa8, 0xa8, 0x90,
+    0x00, 0x00, 0x00, 0x78, 0x88, 0x88, 0x78, 0x28, 0x48, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x08, 0x78, 0x88, 0x78, 0x00, 0x00, 0x00, 0x78,
+    0x80, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+    0x88, 0xf0, 0x88, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x50, 0x50, 0x50, 0xf8,
+    0x88, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0xa8, 0x70, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0x30, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+    0x98, 0xa8, 0xc8, 0x88, 0x00, 0x00, 0x00, 0x50, 0x20, 0x88, 0x98, 0xa8,
+    0xc8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x90, 0xe0, 0x90, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x48, 0x48, 0x48, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x88, 0xd8, 0xa8, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x88, 0x88,
+    0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xc8, 0x88, 0xc8, 0xb0,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x88, 0x78, 0x08, 0x88, 0x70, 0x00, 0x20, 0x20, 0x70,
+    0xa8, 0xa8, 0xa8, 0x70, 0x20, 0x20, 0x00, 0x00, 0x00, 0x88, 0x50, 0x20,
+    0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x90, 0x90, 0x90, 0xf8,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0x88, 0x88, 0x78, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0xa8, 0xa8, 0xa8, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa8, 0xa8, 0xa8, 0xa8, 0xf8, 0x08, 0x08, 0x00, 0x00, 0x00, 0xc0,
+    0x40, 0x70, 0x48, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0xe8,
+    0x98, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x70, 0x48, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x38, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xa8, 0xe8, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x78, 0x88, 0x78, 0x88, 0x88, 0x00, 0x00, 0x00, 0x50, 0x00, 0x70,
+    0x88, 0xf8, 0x80, 0x70, 0x00, 0x00, 0x00, 0x40, 0xf0, 0x40, 0x70, 0x48,
+    0x48, 0x48, 0x08, 0x30, 0x10, 0x20, 0x00, 0x78, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x60, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x80, 0x70, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x20,
+    0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x50, 0x00, 0x60,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x08, 0x08,
+    0x08, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x30, 0x50, 0x98, 0x94, 0x98,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xa0, 0xf0, 0xa8, 0xb0, 0x00, 0x00,
+    0x00, 0x40, 0xf0, 0x40, 0x70, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x10,
+    0x20, 0x88, 0x90, 0xe0, 0x90, 0x88, 0x00, 0x00, 0x00, 0x50, 0x20, 0x88,
+    0x88, 0x98, 0x68, 0x08, 0x88, 0x70, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88,
+    0x88, 0xf8, 0x20, 0x00, 0x00, 0x40, 0xf0, 0x40, 0x70, 0x48, 0x48, 0x70,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0xf0, 0x40, 0x70, 0x48, 0x70, 0x00, 0x00,
+    0x00, 0xa8, 0xa8, 0xa8, 0x70, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa8, 0xa8, 0x70, 0x20, 0x20, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88,
+    0xf8, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0xf8,
+    0x88, 0x70, 0x00, 0x00, 0x00, 0x88, 0x90, 0x90, 0x50, 0x50, 0x50, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x90, 0x50, 0x50, 0x20, 0x00, 0x00,
+    0x50, 0x28, 0x80, 0x88, 0x50, 0x50, 0x50, 0x20, 0x00, 0x00, 0x00, 0x50,
+    0x28, 0x80, 0x88, 0x50, 0x50, 0x20, 0x00, 0x00, 0x08, 0xf8, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x08, 0x78, 0x40, 0x40,
+    0x40, 0x40, 0x00, 0x00, 0x00, 0x78, 0x40, 0x40, 0xf0, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0xf0, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0xa8, 0xa8, 0xa8, 0x70, 0xa8, 0xa8, 0xa8, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0xa8, 0xa8, 0x70, 0xa8, 0xa8, 0x04, 0x04, 0x00, 0x88, 0x90, 0xa0,
+    0xc0, 0xa0, 0x90, 0x88, 0x04, 0x04, 0x00, 0x00, 0x00, 0x88, 0x90, 0xe0,
+    0x90, 0x88, 0x04, 0x04, 0x00, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x88, 0x88, 0x50, 0xf8, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0x50, 0xf8, 0x20, 0x20, 0x20, 0x00, 0x88, 0x88, 0x50,
+    0x20, 0x50, 0x88, 0x88, 0x04, 0x04, 0x00, 0x00, 0x00, 0x88, 0x50, 0x20,
+    0x50, 0x88, 0x04, 0x04, 0x00, 0x80, 0x80, 0xf0, 0x88, 0x88, 0x88, 0x88,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x50, 0x68, 0x48, 0x48, 0x48, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0x08, 0xf8, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x08, 0xf8, 0x88, 0x70, 0x00, 0x00, 0x70, 0x00, 0x70, 0x20,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x60, 0x20, 0x20,
+    0x20, 0x70, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0xf8, 0x88, 0x70, 0x00, 0x00,
+    0x70, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x70,
+    0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x48, 0xb0, 0x90, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x08,
+    0x08, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x68,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf8, 0x10, 0x90, 0x90, 0x90, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x40, 0x30,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x88, 0x88,
+    0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xa8, 0x88, 0x88, 0xf8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0xf0, 0x08, 0x08, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x80, 0x80, 0xf0,
+    0x08, 0x08, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x88, 0x88,
+    0x88, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0x48, 0x88, 0x88, 0xb8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48,
+    0x48, 0x48, 0x48, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x48, 0x68,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0xe0, 0x90, 0xc8, 0x08, 0xf8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x60, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x88, 0x50, 0x20, 0x10, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0x08, 0x88, 0x88, 0xf0, 0x80, 0x80, 0x00, 0x00, 0x00, 0xf0,
+    0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0xc8,
+    0x88, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x88, 0x88, 0x48, 0x88,
+    0x00, 0x00, 0x00, 0x28, 0x30, 0x28, 0x30, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x60, 0x50, 0x50, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x20,
+    0x50, 0x88, 0x88, 0xa8, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x20, 0x20, 0x30,
+    0x28, 0x30, 0x20, 0x20, 0x00, 0x00, 0x00, 0x88, 0xd0, 0xa8, 0xd0, 0xa0,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x88, 0xd0, 0xa0, 0xc0, 0xa0, 0x80, 0x80,
+    0x00, 0x00, 0x00, 0x20, 0x30, 0x28, 0x30, 0x28, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+    0x50, 0x48, 0x50, 0x60, 0x50, 0x40, 0x00, 0x00, 0x00, 0x40, 0x40, 0x60,
+    0x50, 0x50, 0x48, 0x48, 0x00, 0x00, 0x00, 0x88, 0x50, 0x50, 0x20, 0x50,
+    0x50, 0x88, 0x00, 0x00, 0x00, 0x88, 0x70, 0x50, 0xa8, 0x50, 0x70, 0x88,
+    0x00, 0x00, 0x00, 0x60, 0x50, 0x48, 0x50, 0x60, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x88, 0x88, 0xc8, 0xa8, 0xd8, 0xa8, 0x98, 0x00, 0x00, 0x00, 0x20,
+    0xa0, 0x60, 0x30, 0x28, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x70, 0xa8, 0x70,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x30, 0x28, 0x20, 0xa0, 0x60, 0x20,
+    0x00, 0x00, 0x00, 0x88, 0xd0, 0xa0, 0x80, 0xa0, 0xd0, 0x88, 0x00, 0x00,
+    0x00, 0xa8, 0xa8, 0xa8, 0x70, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x80,
+    0x88, 0x98, 0xa8, 0xc8, 0x88, 0x08, 0x00, 0x00, 0x00, 0x20, 0x70, 0xa8,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x60, 0x50, 0x48, 0x70, 0x48,
+    0x50, 0x60, 0x00, 0x00, 0x00, 0x88, 0xd8, 0xa8, 0x88, 0x88, 0x88, 0x88,
+    0x00, 0x00, 0x00, 0x88, 0xd8, 0xa8, 0xd8, 0x88, 0x88, 0x88, 0x00, 0x00,
+    0x00, 0x20, 0x30, 0x28, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x88,
+    0x50, 0x20, 0x50, 0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x88, 0x88, 0xd8,
+    0xa8, 0xd8, 0x88, 0x88, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x50, 0x20,
+    0x50, 0x88, 0x00, 0x00, 0x00, 0xa8, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0xa8, 0x70, 0x20, 0x70, 0xa8, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x28, 0x30, 0x20, 0x20, 0x20, 0x60, 0xa0, 0x00, 0x00, 0x00, 0x20,
+    0x20, 0x20, 0x70, 0xa8, 0xa8, 0xa8, 0x00, 0x00, 0x00, 0x88, 0xd8, 0xa8,
+    0x88, 0xa8, 0xd8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x20, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0xf0, 0x88, 0xf0, 0x88, 0x88, 0xf0, 0x00, 0x00, 0x00, 0x90,
+    0x80, 0xb0, 0xc8, 0x88, 0xc8, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xf0, 0x88, 0x88, 0x88,
+    0x88, 0xf0, 0x00, 0x00, 0x20, 0x08, 0x08, 0x68, 0x98, 0x88, 0x98, 0x68,
+    0x00, 0x00, 0x20, 0x00, 0xf8, 0x80, 0xf0, 0x80, 0x80, 0x80, 0x00, 0x00,
+    0x20, 0x00, 0x30, 0x48, 0x40, 0xf0, 0x40, 0x40, 0x00, 0x00, 0x20, 0x88,
+    0x88, 0xd8, 0xa8, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x20, 0x00, 0xd0,
+    0xa8, 0xa8, 0xa8, 0x88, 0x00, 0x00, 0x20, 0x00, 0xf0, 0x88, 0x88, 0xf0,
+    0x80, 0x80, 0x00, 0x00, 0x00, 0x20, 0x00, 0xb0, 0xc8, 0x88, 0xc8, 0xb0,
+    0x80, 0x80, 0x20, 0x00, 0x70, 0x80, 0x70, 0x08, 0x88, 0x70, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x70, 0x80, 0x70, 0x08, 0xf0, 0x00, 0x00, 0x20, 0x00,
+    0xf8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x40, 0x00, 0x40, 0xf0,
+    0x40, 0x40, 0x48, 0x30, 0x00, 0x00, 0x40, 0x20, 0x88, 0x88, 0xa8, 0xa8,
+    0xd8, 0x88, 0x00, 0x00, 0x00, 0x40, 0x20, 0x88, 0x88, 0xa8, 0xa8, 0x50,
+    0x00, 0x00, 0x10, 0x20, 0x88, 0x88, 0xa8, 0xa8, 0xd8, 0x88, 0x00, 0x00,
+    0x00, 0x10, 0x20, 0x88, 0x88, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x50, 0x00,
+    0x88, 0x88, 0xa8, 0xa8, 0xd8, 0x88, 0x00, 0x00, 0x00, 0x50, 0x00, 0x88,
+    0x88, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x40, 0x20, 0x88, 0x50, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x40, 0x20, 0x00, 0x88, 0x88, 0x98, 0x68, 0x08,
+    0x88, 0x70, 0x30, 0x10, 0x20, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00,
+    0x30, 0x20, 0x10, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x70, 0x28,
+    0x40, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x70, 0x48, 0x20, 0x70,
+    0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x68, 0x30, 0x40, 0x70, 0x88, 0x88,
+    0x98, 0x68, 0x00, 0x00, 0x68, 0x50, 0x20, 0x70, 0x88, 0x88, 0x98, 0x68,
+    0x00, 0x00, 0x78, 0x10, 0x20, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00,
+    0x78, 0x20, 0x10, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x00, 0xd8,
+    0x64, 0xa4, 0x24, 0x3c, 0x24, 0x24, 0x00, 0x00, 0x00, 0xd8, 0xa4, 0x64,
+    0x24, 0x3c, 0x24, 0x24, 0x00, 0x00, 0x00, 0xd8, 0x64, 0xa4, 0xa4, 0x7c,
+    0x24, 0x24, 0x00, 0x00, 0x00, 0xd8, 0xa4, 0x64, 0xa4, 0x7c, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0xd8, 0x64, 0xa4, 0x64, 0xbc, 0x24, 0x24, 0x00, 0x00,
+    0x00, 0xd8, 0xa4, 0x64, 0x64, 0xbc, 0x24, 0x24, 0x00, 0x00, 0x00, 0xd8,
+    0x24, 0xe4, 0x64, 0xbc, 0x24, 0x24, 0x00, 0x00, 0x00, 0xd8, 0x24, 0xe4,
+    0xa4, 0x7c, 0x24, 0x24, 0x00, 0x00, 0x30, 0x10, 0x20, 0x70, 0x88, 0x60,
+    0x88, 0x70, 0x00, 0x00, 0x30, 0x20, 0x10, 0x70, 0x88, 0x60, 0x88, 0x70,
+    0x00, 0x00, 0x70, 0x28, 0x40, 0x70, 0x88, 0x60, 0x88, 0x70, 0x00, 0x00,
+    0x70, 0x48, 0x20, 0x70, 0x88, 0x60, 0x88, 0x70, 0x00, 0x00, 0x68, 0x30,
+    0x40, 0x70, 0x88, 0x60, 0x88, 0x70, 0x00, 0x00, 0x68, 0x50, 0x20, 0x70,
+    0x88, 0x60, 0x88, 0x70, 0x00, 0x00, 0x00, 0xfc, 0x60, 0xa0, 0x38, 0x20,
+    0x20, 0x3c, 0x00, 0x00, 0x00, 0xfc, 0xa0, 0x60, 0x38, 0x20, 0x20, 0x3c,
+    0x00, 0x00, 0x00, 0xfc, 0x60, 0xa0, 0xb8, 0x60, 0x20, 0x3c, 0x00, 0x00,
+    0x00, 0xfc, 0xa0, 0x60, 0xb8, 0x60, 0x20, 0x3c, 0x00, 0x00, 0x00, 0xfc,
+    0x60, 0xa0, 0x78, 0xa0, 0x20, 0x3c, 0x00, 0x00, 0x00, 0xfc, 0xa0, 0x60,
+    0x78, 0xa0, 0x20, 0x3c, 0x00, 0x00, 0x30, 0x10, 0x20, 0xb0, 0xc8, 0x88,
+    0x88, 0x88, 0x08, 0x08, 0x30, 0x20, 0x10, 0xb0, 0xc8, 0x88, 0x88, 0x88,
+    0x08, 0x08, 0x70, 0x28, 0x40, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x08,
+    0x70, 0x48, 0x20, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x08, 0x68, 0x30,
+    0x40, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x08, 0x68, 0x50, 0x20, 0xb0,
+    0xc8, 0x88, 0x88, 0x88, 0x08, 0x08, 0x78, 0x10, 0x20, 0xb0, 0xc8, 0x88,
+    0x88, 0x88, 0x08, 0x08, 0x78, 0x20, 0x10, 0xb0, 0xc8, 0x88, 0x88, 0x88,
+    0x08, 0x08, 0x00, 0xe4, 0x64, 0xa4, 0x3c, 0x24, 0x24, 0x24, 0x00, 0x00,
+    0x00, 0xe4, 0xa4, 0x64, 0x3c, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0xe4,
+    0x64, 0xa4, 0xbc, 0x64, 0x24, 0x24, 0x00, 0x00, 0x00, 0xe4, 0xa4, 0x64,
+    0xbc, 0x64, 0x24, 0x24, 0x00, 0x00, 0x00, 0xe4, 0x64, 0xa4, 0x7c, 0xa4,
+    0x24, 0x24, 0x00, 0x00, 0x00, 0xe4, 0xa4, 0x64, 0x7c, 0xa4, 0x24, 0x24,
+    0x00, 0x00, 0x00, 0xe4, 0x24, 0xe4, 0x7c, 0xa4, 0x24, 0x24, 0x00, 0x00,
+    0x00, 0xe4, 0x24, 0xe4, 0xbc, 0x64, 0x24, 0x24, 0x00, 0x00, 0x60, 0x20,
+    0x40, 0x40, 0x40, 0x40, 0x50, 0x20, 0x00, 0x00, 0x60, 0x40, 0x20, 0x40,
+    0x40, 0x40, 0x50, 0x20, 0x00, 0x00, 0x70, 0x28, 0x40, 0x20, 0x20, 0x20,
+    0x28, 0x10, 0x00, 0x00, 0x70, 0x48, 0x20, 0x20, 0x20, 0x20, 0x28, 0x10,
+    0x00, 0x00, 0x68, 0x30, 0x40, 0x20, 0x20, 0x20, 0x28, 0x10, 0x00, 0x00,
+    0x68, 0x50, 0x20, 0x20, 0x20, 0x20, 0x28, 0x10, 0x00, 0x00, 0x78, 0x10,
+    0x20, 0x20, 0x20, 0x20, 0x28, 0x10, 0x00, 0x00, 0x78, 0x20, 0x10, 0x20,
+    0x20, 0x20, 0x28, 0x10, 0x00, 0x00, 0x00, 0xdc, 0x48, 0x88, 0x08, 0x08,
+    0x08, 0x1c, 0x00, 0x00, 0x00, 0xdc, 0x88, 0x48, 0x08, 0x08, 0x08, 0x1c,
+    0x00, 0x00, 0x00, 0xdc, 0x48, 0x88, 0x88, 0x48, 0x08, 0x1c, 0x00, 0x00,
+    0x00, 0xdc, 0x88, 0x48, 0x88, 0x48, 0x08, 0x1c, 0x00, 0x00, 0x00, 0xdc,
+    0x48, 0x88, 0x48, 0x88, 0x08, 0x1c, 0x00, 0x00, 0x00, 0xdc, 0x88, 0x48,
+    0x48, 0x88, 0x08, 0x1c, 0x00, 0x00, 0x00, 0xdc, 0x08, 0xc8, 0x48, 0x88,
+    0x08, 0x1c, 0x00, 0x00, 0x00, 0xdc, 0x08, 0xc8, 0x88, 0x48, 0x08, 0x1c,
+    0x00, 0x00, 0x30, 0x10, 0x20, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x30, 0x20, 0x10, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x70, 0x28,
+    0x40, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x70, 0x48, 0x20, 0x70,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x68, 0x30, 0x40, 0x70, 0x88, 0x88,
+    0x88, 0x70, 0x00, 0x00, 0x68, 0x50, 0x20, 0x70, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x00, 0xd8, 0x64, 0xa4, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00,
+    0x00, 0xd8, 0xa4, 0x64, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00, 0xd8,
+    0x64, 0xa4, 0xa4, 0x64, 0x24, 0x18, 0x00, 0x00, 0x00, 0xd8, 0xa4, 0x64,
+    0xa4, 0x64, 0x24, 0x18, 0x00, 0x00, 0x00, 0xd8, 0x64, 0xa4, 0x64, 0xa4,
+    0x24, 0x18, 0x00, 0x00, 0x00, 0xd8, 0xa4, 0x64, 0x64, 0xa4, 0x24, 0x18,
+    0x00, 0x00, 0x30, 0x10, 0x20, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x30, 0x20, 0x10, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x70, 0x28,
+    0x40, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x70, 0x48, 0x20, 0x88,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x68, 0x30, 0x40, 0x88, 0x88, 0x88,
+    0x88, 0x70, 0x00, 0x00, 0x68, 0x50, 0x20, 0x88, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x78, 0x10, 0x20, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x78, 0x20, 0x10, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0xd4,
+    0x94, 0x54, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0xd4, 0x94, 0x54,
+    0x88, 0x48, 0x08, 0x08, 0x00, 0x00, 0x00, 0xd4, 0x94, 0x54, 0x48, 0x88,
+    0x08, 0x08, 0x00, 0x00, 0x00, 0xd4, 0x14, 0xd4, 0x88, 0x48, 0x08, 0x08,
+    0x00, 0x00, 0x30, 0x10, 0x20, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x00,
+    0x30, 0x20, 0x10, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x70, 0x28,
+    0x40, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x70, 0x48, 0x20, 0x88,
+    0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x68, 0x30, 0x40, 0x88, 0xa8, 0xa8,
+    0xa8, 0x50, 0x00, 0x00, 0x68, 0x50, 0x20, 0x88, 0xa8, 0xa8, 0xa8, 0x50,
+    0x00, 0x00, 0x78, 0x10, 0x20, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x00,
+    0x78, 0x20, 0x10, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x00, 0xd8,
+    0x64, 0xa4, 0x24, 0x24, 0x18, 0x3c, 0x00, 0x00, 0x00, 0xd8, 0xa4, 0x64,
+    0x24, 0x24, 0x18, 0x3c, 0x00, 0x00, 0x00, 0xd8, 0x64, 0xa4, 0xa4, 0x64,
+    0x18, 0x3c, 0x00, 0x00, 0x00, 0xd8, 0xa4, 0x64, 0xa4, 0x64, 0x18, 0x3c,
+    0x00, 0x00, 0x00, 0xd8, 0x64, 0xa4, 0x64, 0xa4, 0x18, 0x3c, 0x00, 0x00,
+    0x00, 0xd8, 0xa4, 0x64, 0x64, 0xa4, 0x18, 0x3c, 0x00, 0x00, 0x00, 0xd8,
+    0x24, 0xe4, 0x64, 0xa4, 0x18, 0x3c, 0x00, 0x00, 0x00, 0xd8, 0x24, 0xe4,
+    0xa4, 0x64, 0x18, 0x3c, 0x00, 0x00, 0x40, 0x20, 0x00, 0x70, 0x88, 0x88,
+    0x98, 0x68, 0x00, 0x00, 0x10, 0x20, 0x00, 0x70, 0x88, 0x88, 0x98, 0x68,
+    0x00, 0x00, 0x40, 0x20, 0x00, 0x70, 0x88, 0x60, 0x88, 0x70, 0x00, 0x00,
+    0x10, 0x20, 0x00, 0x70, 0x88, 0x60, 0x88, 0x70, 0x00, 0x00, 0x40, 0x20,
+    0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x08, 0x10, 0x20, 0x00, 0xb0,
+    0xc8, 0x88, 0x88, 0x88, 0x08, 0x08, 0x40, 0x20, 0x00, 0x20, 0x20, 0x20,
+    0x28, 0x10, 0x00, 0x00, 0x20, 0x40, 0x00, 0x40, 0x40, 0x40, 0x50, 0x20,
+    0x00, 0x00, 0x40, 0x20, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00,
+    0x10, 0x20, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x40, 0x20,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x10, 0x20, 0x00, 0x88,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x40, 0x20, 0x00, 0x88, 0xa8, 0xa8,
+    0xa8, 0x50, 0x00, 0x00, 0x10, 0x20, 0x00, 0x88, 0xa8, 0xa8, 0xa8, 0x50,
+    0x00, 0x00, 0x30, 0x10, 0x20, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x20,
+    0x30, 0x20, 0x10, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x20, 0x70, 0x28,
+    0x40, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x20, 0x70, 0x48, 0x20, 0x70,
+    0x88, 0x88, 0x98, 0x68, 0x00, 0x20, 0x68, 0x30, 0x40, 0x70, 0x88, 0x88,
+    0x98, 0x68, 0x00, 0x20, 0x68, 0x50, 0x20, 0x70, 0x88, 0x88, 0x98, 0x68,
+    0x00, 0x20, 0x78, 0x10, 0x20, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x20,
+    0x78, 0x20, 0x10, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x20, 0x00, 0xd8,
+    0x64, 0xa4, 0x24, 0x3c, 0x24, 0x24, 0x00, 0x10, 0x00, 0xd8, 0xa4, 0x64,
+    0x24, 0x3c, 0x24, 0x24, 0x00, 0x10, 0x00, 0xd8, 0x64, 0xa4, 0xa4, 0x7c,
+    0x24, 0x24, 0x00, 0x10, 0x00, 0xd8, 0xa4, 0x64, 0xa4, 0x7c, 0x24, 0x24,
+    0x00, 0x10, 0x00, 0xd8, 0x64, 0xa4, 0x64, 0xbc, 0x24, 0x24, 0x00, 0x10,
+    0x00, 0xd8, 0xa4, 0x64, 0x64, 0xbc, 0x24, 0x24, 0x00, 0x10, 0x00, 0xd8,
+    0x24, 0xe4, 0x64, 0xbc, 0x24, 0x24, 0x00, 0x10, 0x00, 0xd8, 0x24, 0xe4,
+    0xa4, 0x7c, 0x24, 0x24, 0x00, 0x10, 0x30, 0x10, 0x20, 0xb0, 0xc8, 0x88,
+    0x88, 0x88, 0x08, 0x88, 0x30, 0x20, 0x10, 0xb0, 0xc8, 0x88, 0x88, 0x88,
+    0x08, 0x88, 0x70, 0x28, 0x40, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x88,
+    0x70, 0x48, 0x20, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x88, 0x68, 0x30,
+    0x40, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x88, 0x68, 0x50, 0x20, 0xb0,
+    0xc8, 0x88, 0x88, 0x88, 0x08, 0x88, 0x78, 0x10, 0x20, 0xb0, 0xc8, 0x88,
+    0x88, 0x88, 0x08, 0x88, 0x78, 0x20, 0x10, 0xb0, 0xc8, 0x88, 0x88, 0x88,
+    0x08, 0x88, 0x00, 0xe4, 0x64, 0xa4, 0x3c, 0x24, 0x24, 0x24, 0x00, 0x10,
+    0x00, 0xe4, 0xa4, 0x64, 0x3c, 0x24, 0x24, 0x24, 0x00, 0x10, 0x00, 0xe4,
+    0x64, 0xa4, 0xbc, 0x64, 0x24, 0x24, 0x00, 0x10, 0x00, 0xe4, 0xa4, 0x64,
+    0xbc, 0x64, 0x24, 0x24, 0x00, 0x10, 0x00, 0xe4, 0x64, 0xa4, 0x7c, 0xa4,
+    0x24, 0x24, 0x00, 0x10, 0x00, 0xe4, 0xa4, 0x64, 0x7c, 0xa4, 0x24, 0x24,
+    0x00, 0x10, 0x00, 0xe4, 0x24, 0xe4, 0x7c, 0xa4, 0x24, 0x24, 0x00, 0x10,
+    0x00, 0xe4, 0x24, 0xe4, 0xbc, 0x64, 0x24, 0x24, 0x00, 0x10, 0x30, 0x10,
+    0x20, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x20, 0x30, 0x20, 0x10, 0x88,
+    0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x20, 0x70, 0x28, 0x40, 0x88, 0xa8, 0xa8,
+    0xa8, 0x50, 0x00, 0x20, 0x70, 0x48, 0x20, 0x88, 0xa8, 0xa8, 0xa8, 0x50,
+    0x00, 0x20, 0x68, 0x30, 0x40, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x20,
+    0x68, 0x50, 0x20, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x20, 0x78, 0x10,
+    0x20, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x20, 0x78, 0x20, 0x10, 0x88,
+    0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x20, 0x00, 0xd8, 0x64, 0xa4, 0x24, 0x24,
+    0x18, 0x3c, 0x00, 0x10, 0x00, 0xd8, 0xa4, 0x64, 0x24, 0x24, 0x18, 0x3c,
+    0x00, 0x10, 0x00, 0xd8, 0x64, 0xa4, 0xa4, 0x64, 0x18, 0x3c, 0x00, 0x10,
+    0x00, 0xd8, 0xa4, 0x64, 0xa4, 0x64, 0x18, 0x3c, 0x00, 0x10, 0x00, 0xd8,
+    0x64, 0xa4, 0x64, 0xa4, 0x18, 0x3c, 0x00, 0x10, 0x00, 0xd8, 0xa4, 0x64,
+    0x64, 0xa4, 0x18, 0x3c, 0x00, 0x10, 0x00, 0xd8, 0x24, 0xe4, 0x64, 0xa4,
+    0x18, 0x3c, 0x00, 0x10, 0x00, 0xd8, 0x24, 0xe4, 0xa4, 0x64, 0x18, 0x3c,
+    0x00, 0x10, 0x88, 0x70, 0x00, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00,
+    0x00, 0xf8, 0x00, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x00, 0x40, 0x20,
+    0x00, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x88, 0x98, 0x68, 0x00, 0x20, 0x10, 0x20, 0x00, 0x70, 0x88, 0x88,
+    0x98, 0x68, 0x00, 0x20, 0x00, 0x78, 0x00, 0x70, 0x88, 0x88, 0x98, 0x68,
+    0x00, 0x00, 0x00, 0x78, 0x00, 0x70, 0x88, 0x88, 0x98, 0x68, 0x00, 0x20,
+    0x88, 0x70, 0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0xf8, 0x00,
+    0x70, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x00, 0x00, 0x00, 0x98, 0x64, 0x24,
+    0x24, 0x3c, 0x24, 0x24, 0x00, 0x00, 0x00, 0x58, 0xa4, 0x24, 0x24, 0x3c,
+    0x24, 0x24, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x88, 0xf8, 0x88, 0x88,
+    0x20, 0x30, 0x00, 0x30, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x10, 0x00, 0x00, 0x00, 0x30,
+    0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88,
+    0x08, 0x88, 0x00, 0x00, 0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x88,
+    0x10, 0x20, 0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x88, 0x00, 0x78,
+    0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x08, 0x08, 0x00, 0x78, 0x00, 0xb0,
+    0xc8, 0x88, 0x88, 0x88, 0x08, 0x88, 0x00, 0xbc, 0x60, 0x20, 0x38, 0x20,
+    0x20, 0x3c, 0x00, 0x00, 0x00, 0x7c, 0xa0, 0x20, 0x38, 0x20, 0x20, 0x3c,
+    0x00, 0x00, 0x00, 0xa4, 0x64, 0x24, 0x3c, 0x24, 0x24, 0x24, 0x00, 0x00,
+    0x00, 0x64, 0xa4, 0x24, 0x3c, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x88,
+    0x88, 0x88, 0xf8, 0x88, 0x88, 0x88, 0x20, 0x30, 0x00, 0x70, 0x28, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x30, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x70, 0x00, 0x20, 0x20, 0x20, 0x28, 0x10, 0x00, 0x00,
+    0x00, 0xf8, 0x00, 0x20, 0x20, 0x20, 0x28, 0x10, 0x00, 0x00, 0x40, 0xa8,
+    0x00, 0x20, 0x20, 0x20, 0x28, 0x10, 0x00, 0x00, 0x10, 0xa8, 0x00, 0x20,
+    0x20, 0x20, 0x28, 0x10, 0x00, 0x00, 0x00, 0x78, 0x00, 0x20, 0x20, 0x20,
+    0x28, 0x10, 0x00, 0x00, 0xf8, 0x00, 0x88, 0x20, 0x20, 0x20, 0x28, 0x10,
+    0x00, 0x00, 0x88, 0x70, 0x70, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00,
+    0xf8, 0x00, 0x70, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x9c,
+    0x48, 0x08, 0x08, 0x08, 0x08, 0x1c, 0x00, 0x00, 0x00, 0x5c, 0x88, 0x08,
+    0x08, 0x08, 0x08, 0x1c, 0x00, 0x00, 0x00, 0x68, 0x30, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x88, 0x70, 0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0xf8,
+    0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x40, 0xa8, 0x00, 0x88,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x10, 0xa8, 0x00, 0x88, 0x88, 0x88,
+    0x88, 0x70, 0x00, 0x00, 0x30, 0x10, 0x20, 0x70, 0x88, 0x88, 0x88, 0xf0,
+    0x80, 0x80, 0x30, 0x20, 0x10, 0x70, 0x88, 0x88, 0x88, 0xf0, 0x80, 0x80,
+    0x00, 0x78, 0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0xf8, 0x00,
+    0x88, 0x00, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x88, 0x70, 0x88, 0x88,
+    0x50, 0x20, 0x20, 0x20, 0x00, 0x00, 0xf8, 0x00, 0x88, 0x88, 0x50, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x94, 0x54, 0x14, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x54, 0x94, 0x14, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0xf8, 0xa4, 0x64, 0x38, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x40,
+    0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x00, 0x88, 0xa8, 0xa8, 0xa8, 0x50,
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x20,
+    0x10, 0x20, 0x00, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x20, 0x00, 0x78,
+    0x00, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x00, 0x78, 0x00, 0x88,
+    0xa8, 0xa8, 0xa8, 0x50, 0x00, 0x20, 0x00, 0x98, 0x64, 0x24, 0x24, 0x24,
+    0x24, 0x18, 0x00, 0x00, 0x00, 0x58, 0xa4, 0x24, 0x24, 0x24, 0x24, 0x18,
+    0x00, 0x00, 0x00, 0x98, 0x64, 0x24, 0x24, 0x24, 0x18, 0x3c, 0x00, 0x00,
+    0x00, 0x58, 0xa4, 0x24, 0x24, 0x24, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x70,
+    0x88, 0x88, 0x88, 0x88, 0x50, 0xd8, 0x20, 0x30, 0x00, 0x10, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc,
+    0x00, 0x10, 0x20, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x10, 0x20, 0x00, 0x00, 0x30, 0x20, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x90, 0xd8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd8, 0x48, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x48, 0x90, 0x00, 0x00, 0xd8,
+    0x90, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0xf8,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0xf8, 0x20, 0xf8,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0x78, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xa8, 0x50, 0x20, 0x68, 0xd4, 0xa8,
+    0x00, 0x00, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x28, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x54,
+    0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x20, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0x00, 0x50, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x10, 0x20, 0x40,
+    0x80, 0x80, 0x00, 0x00, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x00, 0x60, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x30, 0x50, 0x78, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40,
+    0x70, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x70, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x08, 0x10, 0x20, 0x20, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x30, 0x48, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x48, 0x38, 0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x20, 0x20, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x10, 0x10, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x68, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x48, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x60, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x48, 0x10, 0x20, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x08, 0x30, 0x08, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x30, 0x50,
+    0x78, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0x70, 0x08, 0x70,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x70, 0x48, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x08, 0x10, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x48, 0x30, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x48, 0x38, 0x08, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x20, 0x20, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x10, 0x10, 0x10, 0x20, 0x00, 0xf8, 0x80, 0x80, 0xe8, 0xb0,
+    0xa0, 0xa0, 0x00, 0x00, 0x00, 0x30, 0x48, 0xe0, 0x40, 0xe0, 0x48, 0xb0,
+    0x00, 0x00, 0x00, 0x70, 0x48, 0xfc, 0x48, 0x70, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x08, 0x3c, 0x68, 0x98, 0x88, 0x98, 0x68, 0x00, 0xf8, 0x00, 0x30,
+    0x48, 0xe0, 0x40, 0xe0, 0x48, 0x30, 0x00, 0x00, 0x00, 0x40, 0x70, 0xc8,
+    0x48, 0x48, 0xe8, 0xd0, 0x00, 0x00, 0x40, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0xb0, 0xc8,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x98, 0x38, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xf8, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0xf8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0xa8, 0xa0, 0xa0, 0xa0, 0xa8, 0x70, 0x00, 0x00,
+    0x60, 0x80, 0x80, 0x60, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00, 0x10,
+    0x28, 0x28, 0x28, 0x30, 0x20, 0x58, 0x00, 0x00, 0x00, 0x88, 0xc8, 0xc8,
+    0xe8, 0xd8, 0xd8, 0xc8, 0x00, 0x00, 0x00, 0x90, 0x90, 0xd8, 0xb4, 0x94,
+    0x98, 0x9c, 0x00, 0x00, 0x00, 0x70, 0xa8, 0xa8, 0xa8, 0xa8, 0xa8, 0x70,
+    0x18, 0x00, 0x00, 0xf0, 0xa8, 0xa8, 0xb0, 0xa8, 0xa8, 0xa8, 0x00, 0x00,
+    0xfc, 0x5c, 0x54, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+    0x28, 0x28, 0x50, 0xa0, 0xa0, 0xf8, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88,
+    0x88, 0x88, 0x50, 0xd8, 0x00, 0x00, 0x00, 0xd8, 0x50, 0x88, 0x88, 0x88,
+    0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xd8, 0xf8, 0xc0, 0x70,
+    0x00, 0x00, 0x40, 0xc0, 0x40, 0x40, 0xe0, 0x08, 0x14, 0x08, 0x14, 0x08,
+    0xc0, 0x20, 0x40, 0x20, 0xc0, 0x10, 0x28, 0x10, 0x28, 0x10, 0xe0, 0x80,
+    0xc0, 0x20, 0xc0, 0x10, 0x28, 0x10, 0x28, 0x10, 0xe0, 0x20, 0x20, 0x40,
+    0x40, 0x10, 0x28, 0x10, 0x28, 0x10, 0x00, 0x00, 0x00, 0x20, 0x40, 0xfc,
+    0x40, 0x20, 0x00, 0x00, 0x00, 0x20, 0x70, 0xa8, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0xfc, 0x08, 0x10, 0x00, 0x00,
+    0x00, 0x20, 0x20, 0x20, 0x20, 0xa8, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x48, 0xfc, 0x48, 0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0xa8,
+    0x20, 0x20, 0xa8, 0x70, 0x20, 0x00, 0x00, 0x00, 0xf0, 0xc0, 0xa0, 0x90,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x18, 0x28, 0x48, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x48, 0x28, 0x18, 0x78, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x90, 0xa0, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x44, 0xfc, 0x44, 0x24, 0x00, 0x00, 0x00, 0x20, 0x70, 0xa8,
+    0x20, 0x20, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x88, 0xfc,
+    0x88, 0x10, 0x00, 0x00, 0x00, 0x70, 0x20, 0x20, 0x20, 0xa8, 0x70, 0x20,
+    0x00, 0x00, 0x20, 0x70, 0xa8, 0x20, 0x20, 0xa8, 0x70, 0x20, 0xf8, 0x00,
+    0x00, 0x10, 0x08, 0xfc, 0x08, 0x30, 0x40, 0xfc, 0x40, 0x20, 0x00, 0x20,
+    0x40, 0xfc, 0x40, 0x30, 0x08, 0xfc, 0x08, 0x10, 0x00, 0x00, 0x20, 0x40,
+    0xfc, 0x00, 0xfc, 0x08, 0x10, 0x00, 0x00, 0x00, 0x10, 0x08, 0xfc, 0x00,
+    0xfc, 0x40, 0x20, 0x00, 0x00, 0x10, 0x20, 0x7c, 0x80, 0x7c, 0x20, 0x10,
+    0x00, 0x00, 0x00, 0x20, 0x70, 0xd8, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x20, 0x10, 0xf8, 0x04, 0xf8, 0x10, 0x20, 0x00, 0x00, 0x00, 0x50,
+    0x50, 0x50, 0x50, 0xd8, 0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+    0x84, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0xd8, 0x50, 0x50,
+    0xd8, 0x50, 0x20, 0x00, 0x00, 0x88, 0x88, 0x70, 0x50, 0x50, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x20, 0x50, 0x40, 0x40, 0x40, 0x50, 0x20, 0x00, 0x00,
+    0x00, 0x30, 0x08, 0x68, 0x98, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0xf8,
+    0x08, 0x08, 0x78, 0x08, 0x08, 0xf8, 0x00, 0x00, 0x20, 0xf8, 0x28, 0x28,
+    0x78, 0x28, 0x28, 0xf8, 0x20, 0x00, 0x00, 0x00, 0x34, 0x48, 0x94, 0xa4,
+    0x48, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x50, 0x50, 0x88, 0xf8,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x88, 0x50, 0x50, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x78, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x78, 0x00, 0x00, 0x20, 0x78,
+    0xa0, 0xa0, 0xf0, 0xa0, 0xa0, 0x78, 0x20, 0x00, 0x00, 0xf0, 0x08, 0x08,
+    0x78, 0x08, 0x08, 0xf0, 0x00, 0x00, 0x20, 0xf0, 0x28, 0x28, 0x78, 0x28,
+    0x28, 0xf0, 0x20, 0x00, 0xf8, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+    0x50, 0x00, 0xf8, 0x80, 0x40, 0x20, 0x10, 0x20, 0x40, 0x80, 0xf8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0x00, 0x00, 0x08, 0x08, 0x10,
+    0x20, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x48, 0x48,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0x78, 0x30, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0c, 0x10, 0x10, 0x20, 0xa0, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x50, 0x50, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0xa8, 0xa8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x20, 0x50,
+    0x90, 0xf8, 0x10, 0x00, 0x00, 0x20, 0x20, 0x30, 0x20, 0x60, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00,
+    0x00, 0x50, 0x50, 0x58, 0x70, 0xd0, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x50, 0x50, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88,
+    0x50, 0x50, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70,
+    0x00, 0x00, 0x10, 0x28, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0x40,
+    0x10, 0x28, 0x20, 0x70, 0xa8, 0xa8, 0x70, 0x20, 0xa0, 0x40, 0x00, 0x00,
+    0x00, 0x48, 0xa8, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0xa8, 0x10, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x40, 0xa8, 0x10, 0x00, 0xf8,
+    0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xa8, 0x50, 0xa8, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x60, 0xa8, 0x70, 0xa8, 0x30, 0x20, 0x00,
+    0x00, 0x00, 0x20, 0x50, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x60, 0x10,
+    0x20, 0x00, 0x20, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x08, 0x10, 0xf8,
+    0x20, 0xf8, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xf8,
+    0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf8, 0x10, 0xf8, 0x20, 0xf8,
+    0x40, 0x00, 0x00, 0x18, 0x60, 0x80, 0x60, 0x18, 0x00, 0xf8, 0x00, 0x00,
+    0x00, 0xc0, 0x30, 0x08, 0x30, 0xc0, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x24, 0x48, 0x90, 0x48, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x48, 0x24, 0x48, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x80, 0x80,
+    0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x08, 0x08, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x78, 0xa0, 0xa0, 0xa0, 0x78, 0x20, 0x00,
+    0x00, 0x00, 0x20, 0xf0, 0x28, 0x28, 0x28, 0xf0, 0x20, 0x00, 0x00, 0x78,
+    0x80, 0x80, 0x80, 0x78, 0x00, 0xf8, 0x00, 0x00, 0x00, 0xf0, 0x08, 0x08,
+    0x08, 0xf0, 0x00, 0xf8, 0x00, 0x00, 0x20, 0x78, 0xa0, 0xa0, 0xa0, 0x78,
+    0x20, 0xf8, 0x20, 0x00, 0x20, 0xf0, 0x28, 0x28, 0x28, 0xf0, 0x20, 0xf8,
+    0x20, 0x00, 0x00, 0x78, 0x80, 0x80, 0x80, 0x78, 0x20, 0xf8, 0x20, 0x00,
+    0x00, 0xf0, 0x08, 0x08, 0x08, 0xf0, 0x20, 0xf8, 0x20, 0x00, 0x00, 0x00,
+    0x70, 0xa8, 0xf8, 0xa8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xd8,
+    0xa8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xf8,
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x70, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x40, 0x40, 0x70, 0x40, 0x70, 0x40, 0x40, 0x00, 0x00, 0x20, 0x20,
+    0x20, 0x50, 0x50, 0x50, 0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x50,
+    0x50, 0x50, 0x20, 0x20, 0x20, 0x00, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0x88, 0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+    0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x20, 0x00,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x98, 0xa8, 0xc8, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x50, 0x88, 0x88, 0x88, 0xf8, 0x00, 0x00,
+    0x00, 0x70, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x70,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0x40, 0x70, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x28, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0x40, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xfc, 0x00, 0x90, 0x90, 0xf0, 0x90, 0x90, 0x78, 0x10, 0x10, 0x10,
+    0x00, 0x80, 0x80, 0x80, 0xf0, 0x78, 0x40, 0x70, 0x40, 0x40, 0x00, 0x90,
+    0x90, 0x60, 0x40, 0x78, 0x10, 0x10, 0x10, 0x10, 0x00, 0xe0, 0x80, 0xc0,
+    0x80, 0xb8, 0x20, 0x30, 0x20, 0x20, 0x00, 0x70, 0x80, 0x80, 0x70, 0x70,
+    0x48, 0x70, 0x48, 0x48, 0x00, 0x90, 0xd0, 0xd0, 0xb0, 0x90, 0x40, 0x40,
+    0x40, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xa8, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x00,
+    0x30, 0x30, 0x00, 0x30, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x00, 0x20, 0x00, 0x20,
+    0x20, 0x00, 0x20, 0x00, 0x30, 0x30, 0x00, 0x30, 0x00, 0x30, 0x30, 0x00,
+    0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x20, 0x20, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0x3c, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x30, 0x30, 0x30, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x3c, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30,
+    0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x3c, 0x20, 0x20,
+    0x20, 0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x3c, 0x3c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x3c,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x3c, 0x30, 0x30,
+    0x30, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0xe0, 0xe0, 0x20, 0x20, 0x20, 0x20, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0xe0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xe0, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xe0, 0xf0, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xfc, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0xfc, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xfc,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x30, 0x30, 0x30, 0x30,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
+    0xfc, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0xe0, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x3c, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30,
+    0xf0, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x3c, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0xfc, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0xfc, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0xe0, 0xfc, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x3c, 0xfc, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0xfc, 0xfc, 0x20, 0x20, 0x20, 0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xfc, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0xf0, 0xfc, 0x20, 0x20, 0x20, 0x20, 0x30, 0x30,
+    0x30, 0x30, 0x3c, 0xfc, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0xe0, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x20, 0x20, 0x20, 0x20, 0x3c, 0xfc,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc, 0xfc, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xfc, 0xfc, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0xf0, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x3c, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0xfc, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00,
+    0x30, 0x30, 0x30, 0x30, 0x00, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x20,
+    0x3c, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x50, 0x50,
+    0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x40, 0x5c, 0x50, 0x50, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0x20, 0xe0, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf0, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x10, 0xd0, 0x50, 0x50, 0x50, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x20,
+    0x3c, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x50, 0x50, 0x7c, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x50, 0x50, 0x50, 0x5c, 0x40, 0x7c, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0xe0, 0x20, 0xe0, 0x00, 0x00, 0x00, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x50,
+    0xd0, 0x10, 0xf0, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x20,
+    0x3c, 0x20, 0x20, 0x20, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5c, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x5c, 0x40, 0x5c, 0x50, 0x50, 0x50,
+    0x20, 0x20, 0x20, 0x20, 0xe0, 0x20, 0xe0, 0x20, 0x20, 0x20, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0xd0, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+    0xd0, 0x10, 0xd0, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00,
+    0xfc, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x50, 0x50,
+    0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xdc, 0x50, 0x50, 0x50,
+    0x20, 0x20, 0x20, 0x20, 0xfc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x50, 0x50, 0x50, 0x50,
+    0xdc, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0xfc, 0x20,
+    0xfc, 0x20, 0x20, 0x20, 0x50, 0x50, 0x50, 0x50, 0x50, 0xfc, 0x50, 0x50,
+    0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0xdc, 0x00, 0xdc, 0x50, 0x50, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x10, 0x20, 0x20, 0x20, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x10, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40,
+    0x80, 0x80, 0x80, 0x80, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x04, 0x04,
+    0x84, 0x84, 0x48, 0x30, 0x30, 0x30, 0x30, 0x48, 0x84, 0x84, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+    0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+    0xf8, 0xf8, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe0, 0xe0,
+    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0xa8, 0x00, 0x54, 0x00, 0xa8, 0x00, 0x54, 0x00, 0xa8, 0x00, 0xa8, 0x54,
+    0xa8, 0x54, 0xa8, 0x54, 0xa8, 0x54, 0xa8, 0x54, 0xa8, 0xfc, 0x54, 0xfc,
+    0xa8, 0xfc, 0x54, 0xfc, 0xa8, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+    0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0xe0, 0xe0,
+    0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0,
+    0xe0, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xe0, 0xe0, 0xe0,
+    0xe0, 0xe0, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x1c, 0x1c, 0x1c, 0x1c,
+    0x1c, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8,
+    0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x88, 0x88, 0x88, 0xf8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x78, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x48, 0x48, 0x78, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x00, 0x00, 0x00, 0x20, 0x20, 0x70, 0x70,
+    0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x50, 0x50, 0x88, 0xf8,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xf0, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xc0, 0xb0, 0x8c, 0xb0, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0xf8, 0x70, 0x70, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x88,
+    0x50, 0x50, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3c, 0xfc,
+    0x3c, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x34, 0xc4, 0x34, 0x0c,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x70, 0xf8, 0x70, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x50, 0x50, 0x88, 0x50, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0xf8, 0xf8, 0xf8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xf8, 0xf8,
+    0xf8, 0x70, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xcc, 0x84, 0x84, 0xcc, 0xfc,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0xcc, 0xb4, 0xb4, 0xcc, 0xfc, 0xfc, 0xfc,
+    0x00, 0x00, 0x00, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x54, 0x00, 0xb0, 0x34, 0x00, 0xa8, 0x20, 0x00, 0x00, 0x00, 0x78, 0x84,
+    0xcc, 0x84, 0xb4, 0x84, 0x78, 0x00, 0x00, 0x70, 0xf8, 0xa8, 0xf8, 0xa8,
+    0xd8, 0x70, 0x00, 0x00, 0x00, 0x10, 0x54, 0x00, 0xb0, 0x34, 0x00, 0xa8,
+    0x20, 0x00, 0x00, 0x88, 0x70, 0x88, 0x88, 0x88, 0x70, 0x20, 0x70, 0x20,
+    0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x20, 0x70, 0x20, 0x20, 0x70,
+    0x20, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x1c, 0x0c, 0x74,
+    0x88, 0x88, 0x88, 0x70, 0x00, 0x00, 0x00, 0x20, 0x20, 0x70, 0xf8, 0xf8,
+    0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x50, 0xa8, 0xa8, 0x88, 0x50, 0x20,
+    0x00, 0x00, 0x20, 0x50, 0x50, 0x88, 0x88, 0x50, 0x50, 0x20, 0x00, 0x00,
+    0x00, 0x70, 0x20, 0xa8, 0xf8, 0xa8, 0x20, 0x70, 0x00, 0x00, 0x00, 0x20,
+    0x20, 0x50, 0x88, 0xd8, 0x20, 0x70, 0x00, 0x00, 0x00, 0x00, 0x50, 0xf8,
+    0xf8, 0xf8, 0x70, 0x20, 0x00, 0x00, 0x20, 0x70, 0x70, 0xf8, 0xf8, 0x70,
+    0x70, 0x20, 0x00, 0x00, 0x00, 0x00, 0x30, 0x28, 0x20, 0x60, 0xe0, 0x60,
+    0x00, 0x00, 0x00, 0x60, 0x50, 0x48, 0x48, 0xc8, 0xd8, 0x18, 0x00, 0x00,
+    0x00, 0x60, 0x50, 0x68, 0x58, 0xc8, 0xd8, 0x18, 0x00, 0x00, 0x00, 0x40,
+    0x40, 0x50, 0x68, 0x48, 0x50, 0x60, 0x00, 0x00, 0x00, 0x40, 0x48, 0x58,
+    0x68, 0x58, 0x68, 0x48, 0x08, 0x00, 0x00, 0x10, 0x58, 0x70, 0xd0, 0x58,
+    0x70, 0xd0, 0x40, 0x00, 0x00, 0x10, 0x20, 0x20, 0x40, 0x20, 0x20, 0x10,
+    0x00, 0x00, 0x00, 0x40, 0x20, 0x20, 0x10, 0x20, 0x20, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x50, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40, 0x00, 0x50, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x10, 0x00, 0x10,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x10, 0x00, 0x50, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x10, 0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x50, 0x00, 0x00, 0x00, 0x50, 0x00, 0x50, 0x00, 0x50,
+    0x00, 0x50, 0x00, 0x00, 0x00, 0x30, 0x48, 0x40, 0xe8, 0x48, 0x48, 0x48,
+    0x00, 0x00, 0x00, 0x38, 0x48, 0x48, 0xf8, 0x48, 0x48, 0x44, 0x00, 0x00,
+    0x00, 0x70, 0xd8, 0xa8, 0xe8, 0xd8, 0xf8, 0xd8, 0x70, 0x00
+};
+
+Font default_font[1] = {{ .header = { 1597, 6, 10, 176 }, .stride = 1, .ranges = default_font_ranges, .data = default_font_data }};
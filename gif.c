@@ -2,250 +2,866 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/types.h>
-#include <sys/stat.h>
-#include <fcntl.h>
 #include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
 
 #include "gif.h"
+#include "simd.h"
+
+#define MIN(A, B)   ((A) < (B) ? (A) : (B))
+#define MAX(A, B)   ((A) > (B) ? (A) : (B))
 
 /* helper to write a little-endian 16-bit number portably */
-#define write_num(fd, n) write((fd), (uint8_t []) {(n) & 0xFF, (n) >> 8}, 2)
+#define NUM(n)          ((uint8_t []) {(n) & 0xFF, (n) >> 8})
+#define put_num(job, n) put((job), NUM(n), 2)
 
-struct Node {
-    uint16_t key;
-    struct Node *children[0x10];
+/* Background writer: the encoder fills one block while the thread writes
+ * the other one out. */
+struct Writer {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    GIF *gif;
+    uint8_t *block; /* handed to the thread, NULL when it's idle */
+    size_t len;
+    int done;
 };
-typedef struct Node Node;
 
-static Node *
-new_node(uint16_t key)
+/* WriteFunc for a file descriptor, pointed to by arg. */
+int
+write_fd(void *arg, const uint8_t *data, size_t len)
 {
-    Node *node = calloc(1, sizeof(*node));
-    if (node)
-        node->key = key;
-    return node;
+    int fd = *(int *) arg;
+    ssize_t n;
+
+    while (len) {
+        n = write(fd, data, len);
+        if (n == -1) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        data += n;
+        len -= n;
+    }
+    return 0;
 }
 
-static Node *
-new_trie(int *nkeys)
+/* Hand data to the output, which is given up on after the first error. */
+static void
+write_out(GIF *gif, const uint8_t *data, size_t len)
 {
-    Node *root = new_node(0);
-    /* Create nodes for single pixels. */
-    for (*nkeys = 0; *nkeys < 0x10; (*nkeys)++)
-        root->children[*nkeys] = new_node(*nkeys);
-    *nkeys += 2; /* skip clear code and stop code */
-    return root;
+    if (!gif->failed && gif->write(gif->arg, data, len) == -1)
+        gif->failed = 1;
+}
+
+static void *
+run_writer(void *arg)
+{
+    Writer *writer = arg;
+
+    pthread_mutex_lock(&writer->lock);
+    for (;;) {
+        while (!writer->block && !writer->done)
+            pthread_cond_wait(&writer->cond, &writer->lock);
+        if (!writer->block)
+            break;
+        pthread_mutex_unlock(&writer->lock);
+        write_out(writer->gif, writer->block, writer->len);
+        pthread_mutex_lock(&writer->lock);
+        writer->block = NULL;
+        pthread_cond_signal(&writer->cond);
+    }
+    pthread_mutex_unlock(&writer->lock);
+    return NULL;
+}
+
+static Writer *
+new_writer(GIF *gif)
+{
+    Writer *writer = calloc(1, sizeof(*writer));
+    if (!writer)
+        goto no_writer;
+    writer->gif = gif;
+    pthread_mutex_init(&writer->lock, NULL);
+    pthread_cond_init(&writer->cond, NULL);
+    if (pthread_create(&writer->thread, NULL, run_writer, writer))
+        goto no_thread;
+    return writer;
+no_thread:
+    pthread_cond_destroy(&writer->cond);
+    pthread_mutex_destroy(&writer->lock);
+    free(writer);
+no_writer:
+    return NULL;
 }
 
 static void
-del_trie(Node *root)
+del_writer(Writer *writer)
 {
-    int i;
+    pthread_mutex_lock(&writer->lock);
+    writer->done = 1;
+    pthread_cond_signal(&writer->cond);
+    pthread_mutex_unlock(&writer->lock);
+    pthread_join(writer->thread, NULL);
+    pthread_cond_destroy(&writer->cond);
+    pthread_mutex_destroy(&writer->lock);
+    free(writer);
+}
 
-    if (!root)
+/* Write out everything put so far. With a background writer, the block is
+ * only handed over, once the previous one has been written. */
+void
+flush_gif(GIF *gif)
+{
+    Writer *writer = gif->writer;
+    uint8_t *block;
+
+    if (!gif->outlen)
         return;
-    for (i = 0; i < 0x10; i++)
-        del_trie(root->children[i]);
-    free(root);
+    if (!writer) {
+        write_out(gif, gif->out, gif->outlen);
+        gif->outlen = 0;
+        return;
+    }
+    block = gif->out;
+    pthread_mutex_lock(&writer->lock);
+    while (writer->block)
+        pthread_cond_wait(&writer->cond, &writer->lock);
+    writer->block = block;
+    writer->len = gif->outlen;
+    pthread_cond_signal(&writer->cond);
+    pthread_mutex_unlock(&writer->lock);
+    gif->out = block == gif->blocks[0] ? gif->blocks[1] : gif->blocks[0];
+    gif->outlen = 0;
 }
 
+static void
+emit(GIF *gif, const void *data, size_t len)
+{
+    size_t n;
+
+    while (len) {
+        n = OUT_BLOCK - gif->outlen;
+        if (n > len)
+            n = len;
+        memcpy(&gif->out[gif->outlen], data, n);
+        gif->outlen += n;
+        data = (const uint8_t *) data + n;
+        len -= n;
+        if (gif->outlen == OUT_BLOCK)
+            flush_gif(gif);
+    }
+}
+
+static void
+put(Job *job, const void *data, size_t len)
+{
+    memcpy(&job->data[job->len], data, len);
+    job->len += len;
+}
+
+/* Forget all codes but the ones for single pixels. Only codes below nkeys
+ * can have children, so those are the only rows to clear. */
+static void
+clear_table(Encoder *enc, int nkeys)
+{
+    memset(enc->table, 0, nkeys * sizeof(enc->table[0]));
+}
+
+/* Position in the global colour table of each terminal colour. The default
+ * background and foreground come first, then bright white and grey, so that
+ * images of plain text only use the first four entries. */
+static const uint8_t gct_index[0x10] = {
+    0x0, 0x4, 0x5, 0x6, 0x7, 0x8, 0x9, 0x1, 0x3, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF, 0x2
+};
+
 static void put_loop(GIF *gif, uint16_t loop);
+static Pool *new_pool(GIF *gif, int n);
+static void del_pool(Pool *pool);
 
-GIF *
-new_gif(const char *fname, uint16_t w, uint16_t h, uint8_t *gct, int loop)
+/* With encoding threads, twice as many images can be queued, so that the
+ * threads are kept busy while the oldest images are waited for. */
+static GIF *
+alloc_gif(WriteFunc write, void *arg, uint16_t w, uint16_t h, int async,
+          int threads)
 {
-    GIF *gif = calloc(1, sizeof(*gif) + 2*w*h);
+    uint8_t *p;
+    int i, njobs;
+    GIF *gif;
+
+    init_simd();
+    njobs = threads > 0 ? 2*threads : 1;
+    gif = calloc(1, sizeof(*gif) + njobs*sizeof(Job) + h*sizeof(Rect) + 2*w*h +
+                    2*OUT_BLOCK + njobs*(w*h + IMAGE_SIZE(w, h)));
     if (!gif)
         goto no_gif;
     gif->w = w; gif->h = h;
-    gif->cur = (uint8_t *) &gif[1];
+    gif->max_rects = 1;
+    gif->jobs = (Job *) &gif[1];
+    gif->njobs = njobs;
+    gif->rects = (Rect *) &gif->jobs[njobs];
+    gif->cur = (uint8_t *) &gif->rects[h];
     gif->old = &gif->cur[w*h];
+    gif->blocks[0] = &gif->old[w*h];
+    gif->blocks[1] = &gif->blocks[0][OUT_BLOCK];
+    gif->out = gif->blocks[0];
+    p = &gif->blocks[1][OUT_BLOCK];
+    for (i = 0; i < njobs; i++) {
+        gif->jobs[i].pixels = p;
+        gif->jobs[i].data = &p[w*h];
+        p += w*h + IMAGE_SIZE(w, h);
+    }
     /* fill back-buffer with invalid pixels to force overwrite */
     memset(gif->old, 0x10, w*h);
-    gif->fd = creat(fname, 0666);
-    if (gif->fd == -1)
-        goto no_fd;
-    write(gif->fd, "GIF89a", 6);
-    write_num(gif->fd, w);
-    write_num(gif->fd, h);
-    write(gif->fd, (uint8_t []) {0xF3, 0x00, 0x00}, 3);
-    write(gif->fd, gct, 0x30);
-    if (loop >= 0 && loop <= 0xFFFF)
-        put_loop(gif, (uint16_t) loop);
+    gif->write = write;
+    gif->arg = arg;
+    if (async) {
+        gif->writer = new_writer(gif);
+        if (!gif->writer)
+            goto no_writer;
+    }
+    if (threads > 0) {
+        gif->pool = new_pool(gif, threads);
+        if (!gif->pool)
+            goto no_pool;
+    }
     return gif;
-no_fd:
+no_pool:
+    if (gif->writer)
+        del_writer(gif->writer);
+no_writer:
     free(gif);
 no_gif:
     return NULL;
 }
 
+/* A GIF handed block by block to write, along with arg. */
+GIF *
+new_gif(WriteFunc write, void *arg, uint16_t w, uint16_t h, uint8_t *gct,
+        int loop, int async, int threads)
+{
+    uint8_t table[0x30];
+    int i;
+    GIF *gif;
+
+    gif = alloc_gif(write, arg, w, h, async, threads);
+    if (!gif)
+        return NULL;
+    emit(gif, "GIF89a", 6);
+    emit(gif, NUM(w), 2);
+    emit(gif, NUM(h), 2);
+    emit(gif, (uint8_t []) {0xF3, 0x00, 0x00}, 3);
+    for (i = 0; i < 0x10; i++)
+        memcpy(&table[3*gct_index[i]], &gct[3*i], 3);
+    emit(gif, table, 0x30);
+    if (loop >= 0 && loop <= 0xFFFF)
+        put_loop(gif, (uint16_t) loop);
+    return gif;
+}
+
+/* Frames only, to be joined to a GIF with join_gif(). */
+GIF *
+new_part(WriteFunc write, void *arg, uint16_t w, uint16_t h, int threads)
+{
+    GIF *gif = alloc_gif(write, arg, w, h, 0, threads);
+    if (gif)
+        gif->part = 1;
+    return gif;
+}
+
+/* Append the frames of a closed part, from the start of its fd.
+ * Return 0 on success, -1 on error. */
+int
+join_gif(GIF *gif, int fd)
+{
+    uint8_t *block;
+    ssize_t n;
+
+    if (lseek(fd, 0, SEEK_SET) == -1)
+        return -1;
+    block = malloc(OUT_BLOCK);
+    if (!block)
+        return -1;
+    while ((n = read(fd, block, OUT_BLOCK)) != 0) {
+        if (n == -1) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        emit(gif, block, n);
+    }
+    free(block);
+    return n ? -1 : 0;
+}
+
 static void
 put_loop(GIF *gif, uint16_t loop)
 {
-    write(gif->fd, (uint8_t []) {'!', 0xFF, 0x0B}, 3);
-    write(gif->fd, "NETSCAPE2.0", 11);
-    write(gif->fd, (uint8_t []) {0x03, 0x01}, 2);
-    write_num(gif->fd, loop);
-    write(gif->fd, "\0", 1);
+    emit(gif, (uint8_t []) {'!', 0xFF, 0x0B}, 3);
+    emit(gif, "NETSCAPE2.0", 11);
+    emit(gif, (uint8_t []) {0x03, 0x01}, 2);
+    emit(gif, NUM(loop), 2);
+    emit(gif, "\0", 1);
 }
 
 /* Add packed key to buffer, updating offset and partial.
- *   gif->offset holds position to put next *bit*
- *   gif->partial holds bits to include in next byte */
+ *   enc->offset holds position to put next *bit*
+ *   enc->partial holds bits to include in next byte */
 static void
-put_key(GIF *gif, uint16_t key, int key_size)
+put_key(Encoder *enc, Job *job, uint16_t key, int key_size)
 {
     int byte_offset, bit_offset, bits_to_write;
-    byte_offset = gif->offset / 8;
-    bit_offset = gif->offset % 8;
-    gif->partial |= ((uint32_t) key) << bit_offset;
+    byte_offset = enc->offset / 8;
+    bit_offset = enc->offset % 8;
+    enc->partial |= ((uint32_t) key) << bit_offset;
     bits_to_write = bit_offset + key_size;
     while (bits_to_write >= 8) {
-        gif->buffer[byte_offset++] = gif->partial & 0xFF;
+        enc->buffer[byte_offset++] = enc->partial & 0xFF;
         if (byte_offset == 0xFF) {
-            write(gif->fd, "\xFF", 1);
-            write(gif->fd, gif->buffer, 0xFF);
+            put(job, "\xFF", 1);
+            put(job, enc->buffer, 0xFF);
             byte_offset = 0;
         }
-        gif->partial >>= 8;
+        enc->partial >>= 8;
         bits_to_write -= 8;
     }
-    gif->offset = (gif->offset + key_size) % (0xFF * 8);
+    enc->offset = (enc->offset + key_size) % (0xFF * 8);
 }
 
 static void
-end_key(GIF *gif)
+end_key(Encoder *enc, Job *job)
 {
     int byte_offset;
-    byte_offset = gif->offset / 8;
-    if (gif->offset % 8)
-        gif->buffer[byte_offset++] = gif->partial & 0xFF;
+    byte_offset = enc->offset / 8;
+    if (enc->offset % 8)
+        enc->buffer[byte_offset++] = enc->partial & 0xFF;
     if (byte_offset) {
-	write(gif->fd, (uint8_t []) {byte_offset}, 1);
-	write(gif->fd, gif->buffer, byte_offset);
+        put(job, (uint8_t []) {byte_offset}, 1);
+        put(job, enc->buffer, byte_offset);
     }
-    write(gif->fd, "\0", 1);
-    gif->offset = gif->partial = 0;
+    put(job, "\0", 1);
+    enc->offset = enc->partial = 0;
 }
 
+/* Encode the image of job, appending it to its data. */
 static void
-put_image(GIF *gif, uint16_t w, uint16_t h, uint16_t x, uint16_t y)
+put_image(Encoder *enc, Job *job)
 {
-    int nkeys, key_size, i, j;
-    Node *node, *child, *root;
+    int nkeys, key_size, i, n;
+    uint16_t node, child;
+    Rect r = job->r;
+    int mcs = job->mcs;
+    uint16_t clear = 1 << mcs;
+    uint8_t *pixels = job->pixels;
     uint8_t id_packed = 0x00;
 
-    if (gif->plt) {
-        id_packed &= ~0x7;
-        id_packed |= 0x83; /* Local clut, 4 bits. */
-    }
+    if (job->local)
+        id_packed = 0x80 | (mcs - 1); /* Local clut, 2^mcs colours. */
 
-    root = malloc(sizeof(*root));
-    write(gif->fd, ",", 1);
-    write_num(gif->fd, x);
-    write_num(gif->fd, y);
-    write_num(gif->fd, w);
-    write_num(gif->fd, h);
-    write(gif->fd, &id_packed, 1);
+    put(job, ",", 1);
+    put_num(job, r.x);
+    put_num(job, r.y);
+    put_num(job, r.w);
+    put_num(job, r.h);
+    put(job, &id_packed, 1);
     if (id_packed & 0x80)
-        write(gif->fd, gif->plt, 3<<((id_packed & 0x7)+1));
-
-    write(gif->fd, "\x04", 1); /* Min code size */
-    root = node = new_trie(&nkeys);
-    key_size = 5;
-    put_key(gif, 0x10, key_size); /* clear code */
-    for (i = y; i < y+h; i++) {
-        for (j = x; j < x+w; j++) {
-            uint8_t pixel = gif->cur[i*gif->w+j];
-            child = node->children[pixel];
-            if (child) {
-                node = child;
+        put(job, job->lct, 3<<((id_packed & 0x7)+1));
+
+    put(job, (uint8_t []) {mcs}, 1); /* Min code size */
+    /* the table is left clear by the previous image */
+    nkeys = clear + 2;
+    key_size = mcs + 1;
+    put_key(enc, job, clear, key_size); /* clear code */
+    node = pixels[0];
+    n = r.w * r.h;
+    for (i = 1; i < n; i++) {
+        uint8_t pixel = pixels[i];
+        child = enc->table[node][pixel];
+        if (child) {
+            node = child;
+        } else {
+            put_key(enc, job, node, key_size);
+            if (nkeys < 0x1000) {
+                if (nkeys == (1 << key_size))
+                    key_size++;
+                enc->table[node][pixel] = nkeys++;
             } else {
-                put_key(gif, node->key, key_size);
-                if (nkeys < 0x1000) {
-                    if (nkeys == (1 << key_size))
-                        key_size++;
-                    node->children[pixel] = new_node(nkeys++);
-                } else {
-                    put_key(gif, 0x10, key_size); /* clear code */
-                    del_trie(root);
-                    root = node = new_trie(&nkeys);
-                    key_size = 5;
-                }
-                node = root->children[pixel];
+                put_key(enc, job, clear, key_size); /* clear code */
+                clear_table(enc, nkeys);
+                nkeys = clear + 2;
+                key_size = mcs + 1;
             }
+            node = pixel;
         }
     }
-    put_key(gif, node->key, key_size);
-    put_key(gif, 0x11, key_size); /* stop code */
-    end_key(gif);
-    del_trie(root);
+    put_key(enc, job, node, key_size);
+    /* the decoder adds a code after reading the last pixels */
+    if (nkeys == (1 << key_size) && key_size < 12)
+        key_size++;
+    put_key(enc, job, clear + 1, key_size); /* stop code */
+    end_key(enc, job);
+    clear_table(enc, nkeys);
+}
+
+/* Encoding threads. Each image is queued in `jobs` once its pixels are
+ * ready, encoded by whichever thread is free, and emitted in order by the
+ * thread adding frames. */
+typedef struct Worker {
+    Pool *pool;
+    pthread_t thread;
+    Encoder enc;
+} Worker;
+
+struct Pool {
+    GIF *gif;
+    pthread_mutex_t lock;
+    pthread_cond_t work, done;
+    unsigned long queued, taken; /* images queued and taken so far */
+    int quit;
+    int nworkers;
+    Worker *workers;
+};
+
+static void *
+run_worker(void *arg)
+{
+    Worker *worker = arg;
+    Pool *pool = worker->pool;
+    GIF *gif = pool->gif;
+    Job *job;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (pool->taken == pool->queued && !pool->quit)
+            pthread_cond_wait(&pool->work, &pool->lock);
+        if (pool->taken == pool->queued)
+            break;
+        /* images are queued in the order of their slots */
+        job = &gif->jobs[pool->taken++ % gif->njobs];
+        pthread_mutex_unlock(&pool->lock);
+        put_image(&worker->enc, job);
+        pthread_mutex_lock(&pool->lock);
+        job->done = 1;
+        pthread_cond_broadcast(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/* Start n threads, or as many as possible. */
+static Pool *
+new_pool(GIF *gif, int n)
+{
+    int i;
+    Pool *pool = calloc(1, sizeof(*pool) + n*sizeof(Worker));
+    if (!pool)
+        goto no_pool;
+    pool->gif = gif;
+    pool->workers = (Worker *) &pool[1];
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    for (i = 0; i < n; i++) {
+        pool->workers[i].pool = pool;
+        if (pthread_create(&pool->workers[i].thread, NULL, run_worker, &pool->workers[i]))
+            break;
+    }
+    pool->nworkers = i;
+    if (!i)
+        goto no_threads;
+    return pool;
+no_threads:
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->work);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+no_pool:
+    return NULL;
+}
+
+static void
+del_pool(Pool *pool)
+{
+    int i;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+    for (i = 0; i < pool->nworkers; i++)
+        pthread_join(pool->workers[i].thread, NULL);
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->work);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+/* Take the next slot in the queue, emitting the oldest image if it's full. */
+static void retire(GIF *gif, int need);
+
+static Job *
+new_job(GIF *gif)
+{
+    Job *job;
+
+    if (gif->count == gif->njobs)
+        retire(gif, 1);
+    job = &gif->jobs[(gif->head + gif->count++) % gif->njobs];
+    job->len = job->delay_at = 0;
+    job->done = 0;
+    return job;
+}
+
+/* Encode job, or leave it to the threads. */
+static void
+submit(GIF *gif, Job *job)
+{
+    Pool *pool = gif->pool;
+
+    if (!pool) {
+        put_image(&gif->enc, job);
+        job->done = 1;
+        return;
+    }
+    pthread_mutex_lock(&pool->lock);
+    pool->queued++;
+    pthread_cond_signal(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static int
+is_done(GIF *gif, Job *job, int wait)
+{
+    Pool *pool = gif->pool;
+    int done;
+
+    if (!pool)
+        return job->done;
+    pthread_mutex_lock(&pool->lock);
+    while (wait && !job->done)
+        pthread_cond_wait(&pool->done, &pool->lock);
+    done = job->done;
+    pthread_mutex_unlock(&pool->lock);
+    return done;
+}
+
+/* Emit the encoded images at the head of the queue, up to the one held
+ * back, waiting for the first `need` of them. */
+static void
+retire(GIF *gif, int need)
+{
+    Job *job;
+
+    while (gif->count) {
+        job = &gif->jobs[gif->head];
+        if (job == gif->held || !is_done(gif, job, need > 0))
+            break;
+        emit(gif, job->data, job->len);
+        gif->head = (gif->head + 1) % gif->njobs;
+        gif->count--;
+        need--;
+    }
+}
+
+/* The last image of a frame is held back until the next frame is known to
+ * be different, so that it can get a longer delay. */
+static void
+release(GIF *gif)
+{
+    gif->held = NULL;
+    retire(gif, 0);
+}
+
+/* Record that pixels in the given rectangle of `cur` may have changed.
+ * Only these are compared against `old` when the frame is added. */
+void
+mark_drawn(GIF *gif, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if (!w || !h)
+        return;
+    if (gif->left >= gif->right) {
+        gif->left = x; gif->right = x + w;
+        gif->top = y; gif->bottom = y + h;
+        return;
+    }
+    if (x < gif->left) gif->left = x;
+    if (y < gif->top) gif->top = y;
+    if (x + w > gif->right) gif->right = x + w;
+    if (y + h > gif->bottom) gif->bottom = y + h;
+}
+
+static int
+area(Rect r)
+{
+    return r.w * r.h;
+}
+
+static Rect
+join(Rect a, Rect b)
+{
+    Rect r;
+    r.x = MIN(a.x, b.x);
+    r.y = MIN(a.y, b.y);
+    r.w = MAX(a.x + a.w, b.x + b.w) - r.x;
+    r.h = MAX(a.y + a.h, b.y + b.h) - r.y;
+    return r;
 }
 
+/* Find the changed areas of the drawn part of the frame, as bands of
+ * changed rows. A band is joined to the previous one when that adds fewer
+ * pixels than RECT_COST, i.e. when the pixels in between are cheaper to
+ * encode than one more image. Then the closest bands are joined until
+ * there are at most max_rects. Return the number of rectangles. */
 static int
-get_bbox(GIF *gif, uint16_t *w, uint16_t *h, uint16_t *x, uint16_t *y)
-{
-    int i, j, k;
-    int left, right, top, bottom;
-    left = gif->w; right = 0;
-    top = gif->h; bottom = 0;
-    k = 0;
-    for (i = 0; i < gif->h; i++) {
-        for (j = 0; j < gif->w; j++, k++) {
-            if (gif->cur[k] != gif->old[k]) {
-                if (j < left)   left    = j;
-                if (j > right)  right   = j;
-                if (i < top)    top     = i;
-                if (i > bottom) bottom  = i;
+get_rects(GIF *gif)
+{
+    Rect *r = gif->rects;
+    Rect row;
+    int i, k, n, nr;
+    int first, last;
+    int extra, least, best;
+    int cost = gif->plt ? 4 * RECT_COST : RECT_COST;
+
+    n = gif->right - gif->left;
+    nr = 0;
+    for (i = gif->top; i < gif->bottom; i++) {
+        k = i * gif->w + gif->left;
+        first = first_diff(&gif->cur[k], &gif->old[k], n);
+        if (first == n)
+            continue;
+        last = first + last_diff(&gif->cur[k+first], &gif->old[k+first], n - first);
+        row = (Rect) {gif->left + first, i, last - first, 1};
+        if (nr && (r[nr-1].y + r[nr-1].h == i ||
+            area(join(r[nr-1], row)) - area(r[nr-1]) - area(row) < cost))
+            r[nr-1] = join(r[nr-1], row);
+        else
+            r[nr++] = row;
+    }
+    while (nr > gif->max_rects) {
+        least = INT_MAX; best = 0;
+        for (i = 0; i+1 < nr; i++) {
+            extra = area(join(r[i], r[i+1])) - area(r[i]) - area(r[i+1]);
+            if (extra < least) {
+                least = extra;
+                best = i;
             }
         }
+        r[best] = join(r[best], r[best+1]);
+        memmove(&r[best+1], &r[best+2], (nr-best-2) * sizeof(*r));
+        nr--;
+    }
+    return nr;
+}
+
+/* Split rectangles of more than BAND_SIZE pixels into bands of rows, each
+ * one an image of its own, so that they can be encoded in parallel. Every
+ * band costs a few bytes of headers and restarts the LZW table, which is
+ * little once the table has filled up, as it does well before BAND_SIZE
+ * pixels. The bands of all rectangles fit in `rects`, since they are at
+ * least one row each. Return the number of rectangles. */
+static int
+split_rects(GIF *gif, int n)
+{
+    Rect *r = gif->rects;
+    Rect a;
+    int i, b, k, nb, top;
+
+    for (i = k = 0; i < n; i++)
+        k += MIN(MAX(area(r[i]) / BAND_SIZE, 1), r[i].h);
+    n = k;
+    /* from the end, so that rectangles are read before being overwritten */
+    for (i--; i >= 0; i--) {
+        a = r[i];
+        nb = MIN(MAX(area(a) / BAND_SIZE, 1), a.h);
+        for (b = nb; b > 0; b--) {
+            top = a.y + a.h * (b-1) / nb;
+            r[--k] = (Rect) {a.x, top, a.w, a.y + a.h * b / nb - top};
+        }
+    }
+    return n;
+}
+
+/* Prepare the pixels of r for job, as codes of as few bits as possible.
+ * With the global palette, codes are positions in the global table; with a
+ * local palette, the job's `lct` gets only the colours used.
+ * Unless the whole rectangle has to be repainted, unchanged pixels can get
+ * a code that no changed pixel uses, to be marked transparent. This makes
+ * longer runs of the same code, which LZW encodes better, as long as there
+ * are fewer colour changes along the rectangle than with opaque pixels.
+ * Return the transparent code, or -1 for opaque pixels. */
+static int
+get_delta(GIF *gif, Job *job, Rect r, int repaint)
+{
+    int i, j, k, n;
+    int opaque, clear, tc, top;
+    uint16_t all, changed, used;
+    uint8_t pixel, last_opaque, last_clear;
+    uint8_t map[0x10];
+
+    opaque = clear = 0;
+    all = changed = 0;
+    last_opaque = last_clear = 0xFF;
+    for (i = r.y; i < r.y+r.h; i++) {
+        k = i * gif->w + r.x;
+        for (j = 0; j < r.w; j++, k++) {
+            pixel = gif->cur[k];
+            all |= 1 << pixel;
+            opaque += pixel != last_opaque;
+            last_opaque = pixel;
+            if (pixel == gif->old[k])
+                pixel = 0x10;
+            else
+                changed |= 1 << pixel;
+            clear += pixel != last_clear;
+            last_clear = pixel;
+        }
+    }
+    tc = -1;
+    used = all;
+    if (!repaint && changed != 0xFFFF && clear < opaque) {
+        tc = 0;
+        used = changed;
     }
-    if (left != gif->w && top != gif->h) {
-        *x = left; *y = top;
-        *w = right - left + 1;
-        *h = bottom - top + 1;
-        return 1;
+    job->r = r;
+    job->local = gif->plt != NULL;
+    if (job->local) {
+        for (i = n = 0; i < 0x10; i++) {
+            if (used & (1 << i)) {
+                memcpy(&job->lct[3*n], &gif->plt[3*i], 3);
+                map[i] = n++;
+            }
+        }
+        /* the rest, including any transparent colour, is black */
+        memset(&job->lct[3*n], 0, sizeof(job->lct) - 3*n);
+        if (tc >= 0)
+            tc = n++;
+        top = n - 1;
     } else {
-        return 0;
+        used = 0;
+        top = 0;
+        for (i = 0; i < 0x10; i++) {
+            map[i] = gct_index[i];
+            if ((tc >= 0 ? changed : all) & (1 << i)) {
+                used |= 1 << map[i];
+                top = map[i] > top ? map[i] : top;
+            }
+        }
+        if (tc >= 0) {
+            for (tc = 0; used & (1 << tc); tc++) ;
+            top = tc > top ? tc : top;
+        }
     }
+    job->mcs = top < 4 ? 2 : top < 8 ? 3 : 4;
+    n = 0;
+    for (i = r.y; i < r.y+r.h; i++) {
+        k = i * gif->w + r.x;
+        for (j = 0; j < r.w; j++, k++) {
+            pixel = gif->cur[k];
+            job->pixels[n++] = tc >= 0 && pixel == gif->old[k] ? tc : map[pixel];
+        }
+    }
+    return tc;
 }
 
+/* Graphic Control Extension: delay and, if tc >= 0, transparent colour. */
 static void
-set_delay(GIF *gif, uint16_t d)
+set_delay(Job *job, uint16_t d, int tc)
 {
-    write(gif->fd, (uint8_t []) {'!', 0xF9, 0x04, 0x04}, 4);
-    write_num(gif->fd, d);
-    write(gif->fd, "\0\0", 2);
+    put(job, (uint8_t []) {'!', 0xF9, 0x04, tc >= 0 ? 0x05 : 0x04}, 4);
+    put_num(job, d);
+    put(job, (uint8_t []) {tc >= 0 ? tc : 0, 0}, 2);
 }
 
+/* With several images, only the last one has a delay: images without a
+ * delay are shown together with the next one.
+ * A frame without changes only adds its delay to the frame held back, as
+ * far as the 16-bit delay allows. */
 void
 add_frame(GIF *gif, uint16_t d)
 {
-    uint16_t w, h, x, y;
-    uint8_t *tmp;
+    Rect r;
+    Job *job = NULL;
+    int i, j, n;
+    int tc, repaint = 0;
+    uint32_t total;
 
-    if (d)
-        set_delay(gif, d);
     if (gif->plt_dirty) {
-        w = gif->w; h = gif->h; x = y = 0;
+        /* unchanged pixels may have a new colour too */
+        gif->rects[0] = (Rect) {0, 0, gif->w, gif->h};
+        n = 1;
+        repaint = 1;
         gif->plt_dirty = 0;
-    } else
-    if (!get_bbox(gif, &w, &h, &x, &y)) {
-        /* image's not changed; save one pixel just to add delay */
+    } else {
+        n = get_rects(gif);
+    }
+    if (!n) {
         if (!d) return;
-        w = h = 1;
-        x = y = 0;
+        if (gif->held) {
+            /* the encoder does not touch the extension before the image */
+            total = gif->delay + d;
+            d = total > 0xFFFF ? total - 0xFFFF : 0;
+            gif->delay = total - d;
+            gif->held->data[gif->held->delay_at] = gif->delay & 0xFF;
+            gif->held->data[gif->held->delay_at+1] = gif->delay >> 8;
+            if (!d) return;
+        }
+        /* image's not changed; save one pixel just to add delay */
+        gif->rects[0] = (Rect) {0, 0, 1, 1};
+        n = 1;
+    }
+    if (gif->bands)
+        n = split_rects(gif, n);
+    release(gif);
+    for (i = 0; i < n; i++) {
+        r = gif->rects[i];
+        job = new_job(gif);
+        tc = get_delta(gif, job, r, repaint);
+        if (tc >= 0 || (d && i == n-1)) {
+            if (i == n-1)
+                job->delay_at = 4;
+            set_delay(job, i == n-1 ? d : 0, tc);
+        }
+        /* `cur` is drawn over incrementally, so it is kept and only the
+         * changed area is brought up to date in `old` */
+        for (j = r.y; j < r.y+r.h; j++)
+            memcpy(&gif->old[j*gif->w+r.x], &gif->cur[j*gif->w+r.x], r.w);
+        submit(gif, job);
     }
-    put_image(gif, w, h, x, y);
-    tmp = gif->old;
-    gif->old = gif->cur;
-    gif->cur = tmp;
+    if (job->delay_at)
+        gif->held = job;
+    gif->delay = d;
+    gif->left = gif->right = gif->top = gif->bottom = 0;
 }
 
+/* Take what has been drawn as already shown, as if it had been added,
+ * but without any output. */
 void
+skip_frame(GIF *gif)
+{
+    memcpy(gif->old, gif->cur, gif->w * gif->h);
+    gif->plt_dirty = 0;
+    gif->left = gif->right = gif->top = gif->bottom = 0;
+}
+
+/* Return 0 if all of the GIF was written, -1 otherwise. */
+int
 close_gif(GIF* gif)
 {
-    write(gif->fd, ";", 1);
-    close(gif->fd);
+    int ret;
+
+    release(gif);
+    retire(gif, gif->count);
+    if (!gif->part)
+        emit(gif, ";", 1);
+    flush_gif(gif);
+    if (gif->pool)
+        del_pool(gif->pool);
+    if (gif->writer)
+        del_writer(gif->writer);
+    ret = gif->failed ? -1 : 0;
     free(gif);
+    return ret;
 }
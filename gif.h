@@ -1,15 +1,81 @@
+#ifndef CONGIF_GIF_H
+#define CONGIF_GIF_H
+
 #include <stdint.h>
+#include <stddef.h>
+
+#define OUT_BLOCK   0x40000
+#define RECT_COST   0x400
+#define BAND_SIZE   0x10000
+/* room for the largest encoded image: 12-bit codes for every pixel, and
+ * its headers and colour table */
+#define IMAGE_SIZE(w, h)    (2*(w)*(h) + 0x80)
+
+typedef struct Rect {
+    uint16_t x, y, w, h;
+} Rect;
+
+/* LZW state of one encoding thread. */
+typedef struct Encoder {
+    int offset;
+    uint32_t partial;
+    uint8_t buffer[0xFF];
+    uint16_t table[0x1000][0x10]; /* LZW codes: table[prefix][pixel] */
+} Encoder;
+
+/* One image of a frame: the codes of its pixels, and once encoded, the
+ * image with the extension before it. */
+typedef struct Job {
+    Rect r;
+    int mcs;
+    int local; /* has a local colour table, in lct */
+    uint8_t lct[0x30];
+    uint8_t *pixels;
+    uint8_t *data;
+    size_t len, delay_at;
+    int done;
+} Job;
+
+/* Output of a GIF: called with each block in order.
+ * Return 0 on success, -1 on error. */
+typedef int (*WriteFunc)(void *arg, const uint8_t *data, size_t len);
+
+typedef struct Writer Writer;
+typedef struct Pool Pool;
 
 typedef struct GIF {
     uint16_t w, h;
-    int fd;
-    int offset;
+    WriteFunc write;
+    void *arg;
+    int failed; /* a write failed, nothing more is written */
+    int part; /* frames only, see new_part() */
+    Writer *writer;
+    Pool *pool;
+    uint8_t *blocks[2], *out;
+    size_t outlen;
+    /* images not yet emitted, in order */
+    Job *jobs;
+    int njobs, head, count;
+    Job *held; /* last image, emitted once the next frame is known */
+    uint16_t delay;
     uint8_t *cur, *old, *plt;
-    uint32_t partial;
+    uint16_t left, top, right, bottom; /* area drawn since the last frame */
+    int max_rects; /* images per frame */
+    int bands; /* split images of more than BAND_SIZE pixels */
+    Rect *rects;
     uint8_t plt_dirty;
-    uint8_t buffer[0xFF];
+    Encoder enc;
 } GIF;
 
-GIF *new_gif(const char *fname, uint16_t w, uint16_t h, uint8_t *gct, int loop);
+int write_fd(void *arg, const uint8_t *data, size_t len);
+GIF *new_gif(WriteFunc write, void *arg, uint16_t w, uint16_t h, uint8_t *gct,
+             int loop, int async, int threads);
+GIF *new_part(WriteFunc write, void *arg, uint16_t w, uint16_t h, int threads);
+int join_gif(GIF *gif, int fd);
+void mark_drawn(GIF *gif, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void add_frame(GIF *gif, uint16_t d);
-void close_gif(GIF* gif);
+void skip_frame(GIF *gif);
+void flush_gif(GIF *gif);
+int close_gif(GIF* gif);
+
+#endif
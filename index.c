@@ -0,0 +1,238 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "term.h"
+#include "input.h"
+#include "index.h"
+
+#define MIN(A, B)   ((A) < (B) ? (A) : (B))
+
+/* Index file, with 64-bit little-endian numbers:
+ *   "CGIX", version
+ *   size and modification time of the timings and of the dialogue
+ *   rows, columns, cursor option and palette of a new terminal
+ *   number of marks, offset of the table of marks
+ *   snapshots of the terminal, as written by save_term()
+ *   table: clock (in microseconds), line, timings offset, dialogue
+ *          offset and snapshot offset of every mark
+ * The index is only used when all of the header matches. */
+
+typedef struct Entry {
+    Mark mark;
+    long at; /* offset of the snapshot */
+} Entry;
+
+static void
+put_u64(FILE *f, uint64_t n)
+{
+    int i;
+    for (i = 0; i < 8; i++)
+        fputc((n >> (8*i)) & 0xFF, f);
+}
+
+static uint64_t
+get_u64(FILE *f)
+{
+    uint64_t n = 0;
+    int i;
+    for (i = 0; i < 8; i++)
+        n |= (uint64_t) (fgetc(f) & 0xFF) << (8*i);
+    return n;
+}
+
+/* Write the header, or compare it with the one read when check is set.
+ * Return 0 on success (or match), -1 otherwise. */
+static int
+xfer_header(FILE *f, const char *timings, const char *dialogue, Term *term,
+            int cursor, uint64_t *nmarks, uint64_t *table, int check)
+{
+    struct stat st[2];
+    uint64_t head[0x20];
+    uint8_t plt[0x30];
+    int i, n = 0;
+
+    if (stat(timings, &st[0]) == -1 || stat(dialogue, &st[1]) == -1 ||
+        !S_ISREG(st[0].st_mode) || !S_ISREG(st[1].st_mode))
+        return -1;
+    head[n++] = 0x58494743; /* "CGIX" */
+    head[n++] = INDEX_VERSION;
+    for (i = 0; i < 2; i++) {
+        head[n++] = st[i].st_size;
+        head[n++] = st[i].st_mtim.tv_sec;
+        head[n++] = st[i].st_mtim.tv_nsec;
+    }
+    head[n++] = term->rows;
+    head[n++] = term->cols;
+    head[n++] = cursor;
+    if (check) {
+        for (i = 0; i < n; i++)
+            if (get_u64(f) != head[i])
+                return -1;
+        if (fread(plt, 1, sizeof(plt), f) != sizeof(plt) ||
+            memcmp(plt, term->plt, sizeof(plt)))
+            return -1;
+        *nmarks = get_u64(f);
+        *table = get_u64(f);
+        return feof(f) || ferror(f) ? -1 : 0;
+    }
+    for (i = 0; i < n; i++)
+        put_u64(f, head[i]);
+    fwrite(term->plt, 1, sizeof(term->plt), f);
+    put_u64(f, *nmarks);
+    put_u64(f, *table);
+    return ferror(f) ? -1 : 0;
+}
+
+/* Parse the whole session from a copy of term, as it is at the given
+ * offset of the dialogue, keeping a snapshot every INDEX_STEP microseconds of
+ * timings. The index is written to a temporary file first, so that it is
+ * never seen half-written. Return 0 on success, -1 on error. */
+int
+build_index(const char *fname, const char *timings, const char *dialogue,
+            Term *term, size_t offset, int cursor)
+{
+    FILE *fi;
+    Input *ft, *input;
+    Term *copy;
+    Entry *entries = NULL, *more;
+    uint64_t i, nmarks = 0, table = 0;
+    size_t size = 0, len;
+    uint8_t *chunk;
+    int64_t t, clock = 0, next = INDEX_STEP;
+    long line = 0;
+    int n, ret = -1;
+    char *tmp;
+
+    tmp = malloc(strlen(fname) + 5);
+    if (!tmp)
+        goto no_tmp;
+    sprintf(tmp, "%s.tmp", fname);
+    copy = dup_term(term);
+    if (!copy)
+        goto no_copy;
+    ft = open_input(timings);
+    if (!ft)
+        goto no_ft;
+    input = open_input(dialogue);
+    if (!input)
+        goto no_input;
+    if (seek_input(input, offset) == -1)
+        goto no_fi;
+    fi = fopen(tmp, "wb");
+    if (!fi)
+        goto no_fi;
+    if (xfer_header(fi, timings, dialogue, term, cursor, &nmarks, &table, 0) == -1)
+        goto no_header;
+    for (;;) {
+        if (clock >= next) {
+            if (nmarks == size) {
+                size = size ? 2*size : 0x40;
+                more = realloc(entries, size * sizeof(*entries));
+                if (!more)
+                    goto no_header;
+                entries = more;
+            }
+            entries[nmarks].mark = (Mark) {clock, line, tell_input(ft), tell_input(input)};
+            entries[nmarks++].at = ftell(fi);
+            if (save_term(copy, fi) == -1)
+                goto no_header;
+            next = clock + INDEX_STEP;
+        }
+        if (!read_timing(ft, &t, &n))
+            break;
+        while (n > 0 && (len = peek_input(input, &chunk)) > 0) {
+            len = MIN(len, (size_t) n);
+            parse_buf(copy, chunk, len);
+            skip_input(input, len);
+            n -= len;
+        }
+        if (!cursor)
+            copy->mode &= ~M_CURSORVIS;
+        clock += t;
+        line++;
+    }
+    table = ftell(fi);
+    for (i = 0; i < nmarks; i++) {
+        put_u64(fi, entries[i].mark.clock);
+        put_u64(fi, entries[i].mark.line);
+        put_u64(fi, entries[i].mark.timings_at);
+        put_u64(fi, entries[i].mark.dialogue_at);
+        put_u64(fi, entries[i].at);
+    }
+    rewind(fi);
+    if (xfer_header(fi, timings, dialogue, term, cursor, &nmarks, &table, 0) == -1)
+        goto no_header;
+    if (fclose(fi) == 0 && rename(tmp, fname) == 0)
+        ret = 0;
+    fi = NULL;
+no_header:
+    if (fi)
+        fclose(fi);
+    if (ret)
+        remove(tmp);
+    free(entries);
+no_fi:
+    close_input(input);
+no_input:
+    close_input(ft);
+no_ft:
+    free(copy);
+no_copy:
+    free(tmp);
+no_tmp:
+    return ret;
+}
+
+/* Restore term, which must be new, to the last snapshot taken before
+ * clock, and set mark to where the session goes on from there. Return 1
+ * if there is one, 0 if not, and -1 if the index is missing, stale or
+ * made for other options. */
+int
+seek_index(const char *fname, const char *timings, const char *dialogue,
+           Term *term, int cursor, int64_t clock, Mark *mark)
+{
+    FILE *fi;
+    uint64_t i, nmarks, table;
+    Entry entry, best;
+    int ret = -1;
+
+    memset(&best, 0, sizeof(best));
+    fi = fopen(fname, "rb");
+    if (!fi)
+        goto no_fi;
+    if (xfer_header(fi, timings, dialogue, term, cursor, &nmarks, &table, 1) == -1)
+        goto bad;
+    if (fseek(fi, table, SEEK_SET) == -1)
+        goto bad;
+    ret = 0;
+    for (i = 0; i < nmarks; i++) {
+        entry.mark.clock = get_u64(fi);
+        entry.mark.line = get_u64(fi);
+        entry.mark.timings_at = get_u64(fi);
+        entry.mark.dialogue_at = get_u64(fi);
+        entry.at = get_u64(fi);
+        if (feof(fi)) {
+            ret = -1;
+            goto bad;
+        }
+        if (entry.mark.clock >= clock)
+            break;
+        best = entry;
+        ret = 1;
+    }
+    if (ret == 1) {
+        if (fseek(fi, best.at, SEEK_SET) == -1 || load_term(term, fi) == -1)
+            ret = -1;
+        else
+            *mark = best.mark;
+    }
+bad:
+    fclose(fi);
+no_fi:
+    return ret;
+}
@@ -0,0 +1,24 @@
+#ifndef CONGIF_INDEX_H
+#define CONGIF_INDEX_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define INDEX_VERSION   2
+#define INDEX_STEP      30000000 /* microseconds of timings between snapshots */
+
+struct Term;
+
+/* Position in a session, at the start of a timing line. */
+typedef struct Mark {
+    int64_t clock;  /* microseconds of timings before it */
+    long line;      /* timing lines before it */
+    size_t timings_at, dialogue_at; /* offsets in both files */
+} Mark;
+
+int build_index(const char *fname, const char *timings, const char *dialogue,
+                struct Term *term, size_t offset, int cursor);
+int seek_index(const char *fname, const char *timings, const char *dialogue,
+               struct Term *term, int cursor, int64_t clock, Mark *mark);
+
+#endif
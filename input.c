@@ -0,0 +1,200 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+
+#include "input.h"
+
+static int
+map_input(Input *input)
+{
+    struct stat st;
+    void *map;
+
+    if (fstat(input->fd, &st) == -1 || !S_ISREG(st.st_mode))
+        return 0;
+    input->size = st.st_size;
+    if (st.st_size <= 0)
+        return 0;
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, input->fd, 0);
+    if (map == MAP_FAILED)
+        return 0;
+    posix_madvise(map, st.st_size, POSIX_MADV_SEQUENTIAL);
+    input->mapped = 1;
+    input->data = map;
+    input->len = st.st_size;
+    return 1;
+}
+
+Input *
+open_input(const char *fname)
+{
+    Input *input = calloc(1, sizeof(*input));
+    if (!input)
+        goto no_input;
+    input->fd = open(fname, O_RDONLY);
+    if (input->fd == -1)
+        goto no_fd;
+    if (!map_input(input)) {
+        input->data = malloc(INPUT_BLOCK);
+        if (!input->data)
+            goto no_data;
+    }
+    return input;
+no_data:
+    close(input->fd);
+no_fd:
+    free(input);
+no_input:
+    return NULL;
+}
+
+/* Read the input as a stream, in blocks, from where it is. With follow,
+ * the end of the file is waited past for what is appended to it, as with
+ * tail -f. Either way, reading gives up once *stop is set, which a signal
+ * handler can do. Return 0 on success, -1 on error. */
+int
+stream_input(Input *input, int follow, volatile sig_atomic_t *stop)
+{
+    uint8_t *data;
+
+    if (input->mapped) {
+        data = malloc(INPUT_BLOCK);
+        if (!data || lseek(input->fd, input->pos, SEEK_SET) == -1) {
+            free(data);
+            return -1;
+        }
+        munmap(input->data, input->len);
+        input->mapped = 0;
+        input->data = data;
+        input->start = input->pos;
+        input->pos = input->len = 0;
+    }
+    input->follow = follow;
+    input->stop = stop;
+    return 0;
+}
+
+/* Point `slice` at the bytes not consumed yet, reading a new block if all
+ * buffered bytes have been consumed. Return the slice length, 0 at EOF. */
+size_t
+peek_input(Input *input, uint8_t **slice)
+{
+    struct timespec wait = {0, FOLLOW_WAIT};
+    ssize_t n;
+
+    if (input->pos == input->len && !input->mapped) {
+        for (;;) {
+            n = read(input->fd, input->data, INPUT_BLOCK);
+            if (n > 0 || (input->stop && *input->stop))
+                break;
+            if (n == 0 && input->follow)
+                nanosleep(&wait, NULL);
+            else if (n == 0 || errno != EINTR)
+                break;
+        }
+        input->start += input->len;
+        input->pos = 0;
+        input->len = n > 0 ? n : 0;
+    }
+    *slice = &input->data[input->pos];
+    return input->len - input->pos;
+}
+
+void
+skip_input(Input *input, size_t n)
+{
+    input->pos += n;
+}
+
+/* Number of bytes consumed so far. */
+size_t
+tell_input(Input *input)
+{
+    return input->start + input->pos;
+}
+
+/* Go to the given offset, which only works on regular files.
+ * Return 0 on success, -1 on error. */
+int
+seek_input(Input *input, size_t offset)
+{
+    if (input->mapped) {
+        input->pos = offset < input->len ? offset : input->len;
+        return 0;
+    }
+    if (lseek(input->fd, offset, SEEK_SET) == -1)
+        return -1;
+    input->start = offset;
+    input->pos = input->len = 0;
+    return 0;
+}
+
+static int
+get_byte(Input *input)
+{
+    uint8_t *slice;
+
+    if (input->pos == input->len && !peek_input(input, &slice))
+        return -1;
+    return input->data[input->pos++];
+}
+
+#define IS_DIGIT(C) ((C) >= '0' && (C) <= '9')
+#define IS_SPACE(C) ((C) == ' ' || (C) == '\t' || (C) == '\n' || (C) == '\r')
+
+/* Read a timing line, as written by script(1)'s -t option: the delay in
+ * seconds, which is kept in microseconds, and the number of bytes output.
+ * Return 1 on success, 0 at the end of the input or on a malformed line. */
+int
+read_timing(Input *input, int64_t *us, int *n)
+{
+    int64_t t = 0, scale = 100000;
+    long k = 0;
+    int c, digits = 0, neg = 0;
+
+    do c = get_byte(input); while (IS_SPACE(c));
+    for (; IS_DIGIT(c); c = get_byte(input), digits++)
+        if (t < INT64_MAX / 100000000)
+            t = 10*t + (c - '0');
+    t *= 1000000;
+    if (c == '.') {
+        for (c = get_byte(input); IS_DIGIT(c); c = get_byte(input), digits++) {
+            t += (c - '0') * scale;
+            scale /= 10;
+        }
+    }
+    if (!digits || (c != ' ' && c != '\t'))
+        return 0;
+    do c = get_byte(input); while (c == ' ' || c == '\t');
+    if (c == '-' || c == '+') {
+        neg = c == '-';
+        c = get_byte(input);
+    }
+    if (!IS_DIGIT(c))
+        return 0;
+    for (; IS_DIGIT(c); c = get_byte(input))
+        if (k <= INT_MAX)
+            k = 10*k + (c - '0');
+    *us = t;
+    *n = k > INT_MAX ? (neg ? INT_MIN : INT_MAX) : (neg ? -k : k);
+    return 1;
+}
+
+void
+close_input(Input *input)
+{
+    if (input->mapped)
+        munmap(input->data, input->len);
+    else
+        free(input->data);
+    close(input->fd);
+    free(input);
+}
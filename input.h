@@ -0,0 +1,36 @@
+#ifndef CONGIF_INPUT_H
+#define CONGIF_INPUT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <signal.h>
+
+#define INPUT_BLOCK 0x40000
+/* nanoseconds between reads at the end of a file that is followed */
+#define FOLLOW_WAIT 100000000
+
+/* Sequential byte source over a file.
+ * Regular files are memory-mapped as a whole; anything else (pipes,
+ * terminals, failed mappings) is read in blocks of INPUT_BLOCK bytes.
+ * Either way, the bytes are handed out as slices of `data`. */
+typedef struct Input {
+    int fd;
+    int mapped;
+    uint8_t *data;
+    size_t len, pos;
+    size_t start; /* file offset of data[0] */
+    size_t size; /* of a regular file, 0 if unknown */
+    int follow; /* wait for more at the end of the file */
+    volatile sig_atomic_t *stop; /* reading gives up once set */
+} Input;
+
+Input *open_input(const char *fname);
+int stream_input(Input *input, int follow, volatile sig_atomic_t *stop);
+size_t peek_input(Input *input, uint8_t **slice);
+void skip_input(Input *input, size_t n);
+size_t tell_input(Input *input);
+int seek_input(Input *input, size_t offset);
+int read_timing(Input *input, int64_t *us, int *n);
+void close_input(Input *input);
+
+#endif
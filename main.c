@@ -2,170 +2,338 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
-#include <float.h>
 #include <string.h>
+#include <limits.h>
 #include <unistd.h>
+#include <getopt.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
 #include <termios.h>
+#include <time.h>
+#include <glob.h>
+#include <signal.h>
+#include <pthread.h>
 
 #include "term.h"
 #include "mbf.h"
 #include "gif.h"
-#include "default_font.h"
+#include "input.h"
+#include "index.h"
+#include "congif.h"
+#include "session.h"
+#include "batch.h"
+#include "serve.h"
+#include "record.h"
 
 #define MIN(A, B)   ((A) < (B) ? (A) : (B))
 #define MAX(A, B)   ((A) > (B) ? (A) : (B))
 
-#define MIN_DELAY   6
+#define MAX_FPS     100
+/* fonts kept loaded at once */
+#define MAX_FONTS   0x10
 
-static struct Options {
+/* microseconds in s seconds, rounded */
+#define US(S)       ((int64_t) ((S) * 1e6 + 0.5))
+
+/* One conversion, or with batch set, the options shared by a batch. */
+typedef struct Options {
     char *timings, *dialogue;
     char *output;
-    float maxdelay, divisor;
-    int loop;
-    char *font;
     int height, width;
-    int cursor;
     int quiet;
+    int follow;
+    int segments;
+    char *index;
     int barsize;
+    char *batch;
+    int workers;
+    char *serve, *connect;
+    int depth;
+    char **command;         /* to record, NULL for none */
+    char *font, *palette;   /* to load, as given */
+    Config cfg;
+    Cache *warm;            /* glyphs kept by a worker of the server */
 
     int has_winsize;
     struct winsize size;
-} options;
 
-uint8_t
-get_pair(Term *term, int row, int col)
+    /* what was converted, for the batch report */
+    uint64_t bytes_in, bytes_out;
+    int64_t played;
+
+    /* where messages go, and for a job sent to the server, the directory
+     * its names are relative to */
+    FILE *log;
+    char *dir;
+    char *paths[6];
+    int npaths;
+} Options;
+
+static Options options;
+
+/* set on SIGINT or SIGTERM, to finish the GIF with what was read */
+static volatile sig_atomic_t stopping;
+
+static void
+on_signal(int sig)
 {
-    Cell cell;
-    uint8_t fore, back;
-    int inverse;
-
-    inverse = term->mode & M_REVERSE;
-    if (term->mode & M_CURSORVIS)
-        inverse = term->row == row && term->col == col ? !inverse : inverse;
-    cell = term->addr[row][col];
-    inverse = cell.attr & A_INVERSE ? !inverse : inverse;
-    fore = cell.pair >> 4;
-    back = cell.pair & 0xF;
-    if (cell.attr & (A_ITALIC | A_CROSSED))
-        fore = 0x2;
-    else if (cell.attr & A_UNDERLINE)
-        fore = 0x6;
-    else if (cell.attr & A_DIM)
-        fore = 0x8;
-    if (inverse) {
-        uint8_t t;
-        t = fore; fore = back; back = t;
-    }
-    if (cell.attr & A_BOLD)
-        fore |= 0x8;
-    if (cell.attr & A_BLINK)
-        back |= 0x8;
-    if ((cell.attr & A_INVISIBLE) != 0) fore = back;
-    return (fore << 4) | (back & 0xF);
+    (void) sig;
+    stopping = 1;
 }
 
-void
-draw_char(Font *font, GIF *gif, uint16_t code, uint8_t pair, int row, int col)
+static long bar_done;
+
+static void
+show_progress(uint64_t i, uint64_t c)
 {
-    int i, j;
-    int x, y;
-    int index;
-    int pixel;
-    uint8_t *strip;
-
-    index = get_index(font, code);
-    if (index == -1)
-        return;
-    strip = &font->data[font->stride * font->header.h * index];
-    y = font->header.h * row;
-    for (i = 0; i < font->header.h; i++) {
-        x = font->header.w * col;
-        for (j = 0; j < font->header.w; j++) {
-            pixel = strip[j >> 3] & (1 << (7 - (j & 7)));
-            gif->cur[y * gif->w + x] = pixel ? pair >> 4 : pair & 0xF;
-            x++;
+    long done = MIN(i, c) * (options.barsize-2) / c;
+
+    if (done > bar_done) {
+        while (done > bar_done) {
+            putchar('#');
+            bar_done++;
         }
-        y++;
-        strip += font->stride;
+        fflush(stdout);
     }
 }
 
-void
-render(Term *term, Font *font, GIF *gif, uint16_t delay)
+/* Feed the n dialogue bytes of the last timing line. */
+static void
+feed(Session *s, Input *dialogue, int n)
+{
+    size_t len;
+    uint8_t *chunk;
+
+    while (n > 0 && (len = peek_input(dialogue, &chunk)) > 0) {
+        len = MIN(len, (size_t) n);
+        feed_session(s, chunk, len);
+        skip_input(dialogue, len);
+        n -= len;
+    }
+}
+
+/* Play the rest of the session. The progress bar goes by the bytes read
+ * out of total, if not 0. */
+static void
+play(Session *s, Input *timings, Input *dialogue, uint64_t total)
+{
+    int64_t t;
+    int n;
+
+    while (!session_ended(s) && !stopping && read_timing(timings, &t, &n)) {
+        if (total)
+            show_progress(tell_input(timings) + tell_input(dialogue), total);
+        time_session(s, t);
+        feed(s, dialogue, n);
+    }
+}
+
+/* A part of the session converted on its own, from a copy of the
+ * session as it was at the keyframe. */
+typedef struct Segment {
+    Options *o;
+    Session *s;     /* at the keyframe */
+    size_t timings_at, dialogue_at;
+    int n;          /* dialogue bytes of the keyframe's line */
+    long end;       /* line of the segment's last frame, 0 for the end */
+    int shown;      /* the keyframe ends the previous segment */
+    FILE *tmp;      /* frames of the segment */
+    int fd;
+    pthread_t thread;
+    int ret;
+} Segment;
+
+static void *
+convert_segment(void *arg)
 {
-    int i, j;
-    uint16_t code;
-    uint8_t pair;
-
-    for (i = 0; i < term->rows; i++) {
-        for (j = 0; j < term->cols; j++) {
-            code = term->addr[i][j].code;
-            pair = get_pair(term, i, j);
-            draw_char(font, gif, code, pair, i, j);
+    Segment *seg = arg;
+    Session *s = seg->s;
+    Input *timings, *dialogue;
+    int64_t t;
+    int n;
+
+    seg->ret = 1;
+    timings = open_input(seg->o->timings);
+    if (!timings)
+        goto no_ft;
+    dialogue = open_input(seg->o->dialogue);
+    if (!dialogue)
+        goto no_fd;
+    if (seek_input(timings, seg->timings_at) == -1 ||
+        seek_input(dialogue, seg->dialogue_at) == -1)
+        goto no_part;
+    seg->fd = fileno(seg->tmp);
+    if (start_part(s, write_fd, &seg->fd, seg->shown, !seg->end) == -1)
+        goto no_part;
+    feed(s, dialogue, seg->n);
+    while (!session_ended(s) && read_timing(timings, &t, &n)) {
+        time_session(s, t);
+        if (session_line(s) == seg->end)
+            break;
+        feed(s, dialogue, n);
+    }
+    seg->ret = 0;
+no_part:
+    close_input(dialogue);
+no_fd:
+    close_input(timings);
+no_ft:
+    return NULL;
+}
+
+/* Play the session without drawing, keeping a copy of it every 1/nsegs
+ * of the dialogue, then convert the segments between these keyframes in
+ * parallel and join them to the GIF of s in order. The first segment
+ * starts where s is. */
+static int
+convert_segments(Options *o, Session *s, Input *timings, Input *dialogue,
+                 uint64_t total)
+{
+    Segment *segs;
+    Session *run;
+    int64_t t;
+    int n, i, k, nsegs = o->segments, ret = 1;
+
+    segs = calloc(nsegs, sizeof(*segs));
+    if (!segs)
+        goto no_segs;
+    k = 0;
+    run = dup_session(s);
+    if (!run)
+        goto no_run;
+    segs[0].s = dup_session(s);
+    segs[0].timings_at = tell_input(timings);
+    segs[0].dialogue_at = tell_input(dialogue);
+    if (!segs[0].s)
+        goto no_keyframe;
+    k = 1;
+    while (k < nsegs && !session_ended(run) && read_timing(timings, &t, &n)) {
+        if (total)
+            show_progress(tell_input(timings) + tell_input(dialogue), total);
+        if (time_session(run, t) &&
+            tell_input(dialogue) * nsegs >= k * dialogue->size) {
+            segs[k-1].end = session_line(run);
+            segs[k].s = dup_session(run);
+            if (!segs[k].s)
+                goto no_keyframe;
+            segs[k].timings_at = tell_input(timings);
+            segs[k].dialogue_at = tell_input(dialogue);
+            segs[k].n = n;
+            segs[k].shown = 1;
+            k++;
+        }
+        feed(run, dialogue, n);
+    }
+    nsegs = k;
+    for (i = 0; i < nsegs; i++) {
+        segs[i].o = o;
+        segs[i].tmp = tmpfile();
+        if (!segs[i].tmp ||
+            pthread_create(&segs[i].thread, NULL, convert_segment, &segs[i])) {
+            if (segs[i].tmp)
+                fclose(segs[i].tmp);
+            fprintf(o->log, "error: could not start segment %d\n", i);
+            nsegs = i;
+            goto no_thread;
         }
     }
+    ret = 0;
+no_thread:
+    for (i = 0; i < nsegs; i++) {
+        pthread_join(segs[i].thread, NULL);
+        resume_session(s, session_line(segs[i].s), session_clock(segs[i].s));
+        if (close_session(segs[i].s) == -1)
+            segs[i].ret = 1;
+        segs[i].s = NULL;
+        if (!ret && (segs[i].ret || join_part(s, fileno(segs[i].tmp)))) {
+            fprintf(o->log, "error: could not convert segment %d\n", i);
+            ret = 1;
+        }
+        fclose(segs[i].tmp);
+        if (o->barsize)
+            show_progress(i+1, nsegs);
+    }
+no_keyframe:
+    for (i = 0; i < k; i++)
+        if (segs[i].s)
+            close_session(segs[i].s);
+    close_session(run);
+no_run:
+    free(segs);
+no_segs:
+    return ret;
+}
 
-    if (term->plt_local)
-        gif->plt = term->plt;
-    else
-        gif->plt = 0;
-    gif->plt_dirty |= term->plt_dirty;
-    term->plt_dirty = 0;
+/* GIF output to a file, counting the bytes written. */
+typedef struct Output {
+    int fd;
+    uint64_t bytes;
+} Output;
+
+static int
+write_output(void *arg, const uint8_t *data, size_t len)
+{
+    Output *out = arg;
 
-    add_frame(gif, delay);
+    if (write_fd(&out->fd, data, len) == -1)
+        return -1;
+    out->bytes += len;
+    return 0;
 }
 
 int
-convert_script()
+convert_script(Options *o)
 {
-    FILE *ft;
-    int fd;
-    float t;
-    int n;
-    uint8_t ch;
-    Font *font;
-    int w, h;
-    int i, c;
-    float d;
-    uint16_t rd, id = 0;
-    float lastdone, done;
-    char pb[options.barsize+1];
+    Input *timings, *dialogue;
+    uint8_t *chunk, *eol;
+    size_t len, k;
+    int i;
+    Output out = {-1, 0};
+    char pb[o->barsize+1];
     char fl[512];
     int fln = 0;
-    GIF *gif;
-    Term *term;
+    Session *s;
+    Mark mark;
+    uint64_t total = 0;
+    int found, streaming, ret = 1;
 
-    ft = fopen(options.timings, "r");
-    if (!ft) {
-        fprintf(stderr, "error: could not load timings: %s\n", options.timings);
+    timings = open_input(o->timings);
+    if (!timings) {
+        fprintf(o->log, "error: could not load timings: %s\n", o->timings);
         goto no_ft;
     }
-    fd = open(options.dialogue, O_RDONLY);
-    if (fd == -1) {
-        fprintf(stderr, "error: could not load dialogue: %s\n", options.dialogue);
+    dialogue = open_input(o->dialogue);
+    if (!dialogue) {
+        fprintf(o->log, "error: could not load dialogue: %s\n", o->dialogue);
         goto no_fd;
     }
-    if (options.font == 0) {
-	font = default_font;
-    } else {
-	font = load_font(options.font);
-	if (!font) {
-	    fprintf(stderr, "error: could not load font: %s\n", options.font);
-	    goto no_font;
-	}
+    /* pipes and files being written to are read as they come */
+    streaming = o->follow || !timings->mapped || !dialogue->mapped;
+    if (streaming && (stream_input(timings, o->follow, &stopping) == -1 ||
+                      stream_input(dialogue, o->follow, &stopping) == -1)) {
+        fprintf(o->log, "error: could not read inputs as streams\n");
+        goto no_fd_out;
+    }
+    if (streaming && (o->segments > 1 || o->index)) {
+        fprintf(o->log, "error: segments and indexes need complete regular files\n");
+        goto no_fd_out;
     }
 
     /* Save first line of dialogue */
-    do {
-        if (read(fd, &ch, 1) <= 0) break;
-        if (fln<(int)sizeof(fl)-1) fl[fln++]=ch;
-    } while (ch != '\n');
+    while ((len = peek_input(dialogue, &chunk)) > 0) {
+        eol = memchr(chunk, '\n', len);
+        if (eol)
+            len = eol - chunk + 1;
+        k = MIN(len, sizeof(fl) - 1 - fln);
+        memcpy(&fl[fln], chunk, k);
+        fln += k;
+        skip_input(dialogue, len);
+        if (eol) break;
+    }
     /* Inspect it for the terminal size if needed */
-    if (fln > 16 && (options.height == 0 || options.width == 0)) {
+    if (fln > 16 && (o->height == 0 || o->width == 0)) {
         int col=0, ln=0;
         char * s;
         fl[fln] = 0;
@@ -175,103 +343,172 @@ convert_script()
         if (s) ln = atoi(s+7);
 
         if (ln>0 && col>0) {
-            if (options.width <= 0)
-                options.width = col;
-            if (options.height <= 0)
-                options.height = ln;
+            if (o->width <= 0)
+                o->width = col;
+            if (o->height <= 0)
+                o->height = ln;
         }
     }
 
     /* Default the VT to our real terminal */
-    if (options.has_winsize && (options.height == 0 || options.width == 0)) {
-        if (options.height <= 0)
-            options.height = options.size.ws_row;
-        if (options.width <= 0)
-            options.width = options.size.ws_col;
+    if (o->has_winsize && (o->height == 0 || o->width == 0)) {
+        if (o->height <= 0)
+            o->height = o->size.ws_row;
+        if (o->width <= 0)
+            o->width = o->size.ws_col;
     }
 
-    if (options.width <= 0 || options.height <= 0) {
-        fprintf(stderr, "error: no terminal size specified\n");
-        goto no_termsize;
+    if (o->width <= 0 || o->height <= 0) {
+        fprintf(o->log, "error: no terminal size specified\n");
+        goto no_fd_out;
     }
+    o->cfg.rows = o->height;
+    o->cfg.cols = o->width;
+    o->cfg.flush = streaming;
 
-    term = new_term(options.height, options.width);
-    w = term->cols * font->header.w;
-    h = term->rows * font->header.h;
-    gif = new_gif(options.output, w, h, term->plt, options.loop);
-    if (!gif) {
-        fprintf(stderr, "error: could not create GIF: %s\n", options.output);
-        goto no_gif;
+    out.fd = strcmp(o->output, "-") ? creat(o->output, 0666) : dup(1);
+    if (out.fd == -1) {
+        fprintf(o->log, "error: could not create GIF: %s\n", o->output);
+        goto no_fd_out;
     }
-    if (options.barsize) {
+    s = new_warm_session(&o->cfg, o->warm, write_output, &out);
+    if (!s) {
+        fprintf(o->log, "error: could not start conversion\n");
+        goto no_session;
+    }
+    if (o->segments > 1 && (seek_input(timings, 0) == -1 ||
+        seek_input(dialogue, tell_input(dialogue)) == -1)) {
+        fprintf(o->log, "error: segments can only be made from regular files\n");
+        goto no_seek;
+    }
+    if (o->barsize && !streaming) {
         pb[0] = '[';
-        pb[options.barsize-1] = ']';
-        pb[options.barsize] = '\0';
-        for (i = 1; i < options.barsize-1; i++)
+        pb[o->barsize-1] = ']';
+        pb[o->barsize] = '\0';
+        for (i = 1; i < o->barsize-1; i++)
             pb[i] = '-';
-        lastdone = 0;
         printf("%s\r[", pb);
-        /* get number of chunks */
-        for (c = 0; fscanf(ft, "%f %d\n", &t, &n) == 2; c++);
-        rewind(ft);
-    }
-    i = 0;
-    d = rd = 0;
-    while (fscanf(ft, "%f %d\n", &t, &n) == 2) {
-        if (options.barsize) {
-            done = i * (options.barsize-1) / c;
-            if (done > lastdone) {
-                while (done > lastdone) {
-                    putchar('#');
-                    lastdone++;
-                }
-                fflush(stdout);
-            }
-        }
-        d += (MIN(t, options.maxdelay) * 100.0 / options.divisor);
-        rd = (uint16_t) MIN((int)(d + 0.5), 65535);
-        if (i && rd >= MIN_DELAY) {
-            render(term, font, gif, rd);
-            d = 0;
+        total = timings->size + dialogue->size;
+    }
+    if (o->index) {
+        found = seek_index(o->index, o->timings, o->dialogue,
+                           session_term(s), o->cfg.cursor, o->cfg.start, &mark);
+        if (found == -1) {
+            if (build_index(o->index, o->timings, o->dialogue,
+                            session_term(s), tell_input(dialogue), o->cfg.cursor) == -1)
+                fprintf(o->log, "warning: could not write index: %s\n", o->index);
+            else
+                found = seek_index(o->index, o->timings, o->dialogue,
+                                   session_term(s), o->cfg.cursor, o->cfg.start, &mark);
         }
-        if (i == 0) { id = rd; rd = 0; d = 0; }
-        while (n--) {
-            read(fd, &ch, 1);
-            parse(term, ch);
+        if (found == 1) {
+            /* go on from the snapshot */
+            if (seek_input(timings, mark.timings_at) == -1 ||
+                seek_input(dialogue, mark.dialogue_at) == -1) {
+                fprintf(o->log, "error: could not seek to index mark\n");
+                goto no_seek;
+            }
+            resume_session(s, mark.line, mark.clock);
         }
-        if (!options.cursor)
-            term->mode &= ~M_CURSORVIS;
-        i++;
     }
-    rd += id;
-    if (options.barsize) {
-        while (lastdone < options.barsize-2) {
+    if (o->segments > 1) {
+        ret = convert_segments(o, s, timings, dialogue, total);
+    } else {
+        play(s, timings, dialogue, total);
+        ret = 0;
+    }
+    if (o->barsize && !streaming) {
+        while (bar_done < o->barsize-2) {
             putchar('#');
-            lastdone++;
+            bar_done++;
         }
         putchar('\n');
     }
-    render(term, font, gif, MAX(rd, 1));
-    close_gif(gif);
-    free(term);
-    return 0;
-no_gif:
-    free(term);
-no_termsize:
-    if (options.font) free(font);
-no_font:
-    close(fd);
+    o->bytes_in = MAX(timings->size, tell_input(timings)) +
+                  MAX(dialogue->size, tell_input(dialogue));
+    o->played = o->cfg.end ? MIN(session_clock(s), o->cfg.end) : session_clock(s);
+    o->played -= MIN(o->played, o->cfg.start);
+no_seek:
+    if (close_session(s) == -1) {
+        fprintf(o->log, "error: could not write GIF: %s\n", o->output);
+        ret = 1;
+    }
+    o->bytes_out = out.bytes;
+no_session:
+    close(out.fd);
+no_fd_out:
+    close_input(dialogue);
 no_fd:
-    fclose(ft);
+    close_input(timings);
 no_ft:
-    return 1;
+    return ret;
+}
+
+static void
+take_output(void *arg, int64_t us, const uint8_t *data, size_t len)
+{
+    push_session(arg, us, data, len);
+}
+
+/* Run the command on a terminal of the given size, or of the size of
+ * ours, converting its output as it comes. Return the exit status of the
+ * command, or 1 on error, in which case no GIF is left. */
+static int
+record_session(Options *o)
+{
+    Output out = {-1, 0};
+    Session *s;
+    int status, done = 0, ret = 1;
+
+    if (o->has_winsize) {
+        if (o->height <= 0)
+            o->height = o->size.ws_row;
+        if (o->width <= 0)
+            o->width = o->size.ws_col;
+    }
+    if (o->width <= 0 || o->height <= 0) {
+        fprintf(o->log, "error: no terminal size specified\n");
+        goto no_fd_out;
+    }
+    o->cfg.rows = o->height;
+    o->cfg.cols = o->width;
+    out.fd = creat(o->output, 0666);
+    if (out.fd == -1) {
+        fprintf(o->log, "error: could not create GIF: %s\n", o->output);
+        goto no_fd_out;
+    }
+    s = new_warm_session(&o->cfg, o->warm, write_output, &out);
+    if (!s) {
+        fprintf(o->log, "error: could not start conversion\n");
+        goto no_session;
+    }
+    if (record(o->command, o->height, o->width, take_output, s, &status) == 0) {
+        ret = status;
+        done = 1;
+    }
+    if (close_session(s) == -1) {
+        fprintf(o->log, "error: could not write GIF: %s\n", o->output);
+        ret = 1;
+        done = 0;
+    }
+no_session:
+    close(out.fd);
+    if (!done) {
+        fprintf(o->log, "error: recording failed, no GIF written\n");
+        unlink(o->output);
+    }
+no_fd_out:
+    return ret;
 }
 
 void
 help(char *name)
 {
     fprintf(stderr,
-        "Usage: %s [options] timings dialogue\n\n"
+        "Usage: %s [options] timings dialogue\n"
+        "       %s [options] --batch manifest|pattern\n"
+        "       %s [options] --serve socket\n"
+        "       %s [options] --record -- command [arguments]\n\n"
         "timings:       File generated by script(1)'s -t option\n"
         "dialogue:      File generated by script(1)'s regular output\n\n"
         "options:\n"
@@ -279,94 +516,696 @@ help(char *name)
         "  -m maxdelay  Maximum delay, as in scriptreplay(1)\n"
         "  -d divisor   Speedup, as in scriptreplay(1)\n"
         "  -l count     GIF loop count (0 = infinite loop)\n"
+        "  -r count     Maximum number of images per frame\n"
+        "  -F, --fps N  Sample the session N times per second\n"
+        "  -S, --start T  Start at T seconds into the session\n"
+        "  -E, --end T    End at T seconds into the session\n"
+        "  -x, --index file  Seek index of the session, made if needed\n"
         "  -f font      File name of MBF font to use\n"
         "  -h lines     Terminal height\n"
         "  -w columns   Terminal width\n"
         "  -c on|off    Show/hide cursor\n"
         "  -p palette   Define color palette, '@help' for std else file.\n"
         "  -q           Quiet mode (don't show progress bar)\n"
+        "  -b           Write GIF output from a background thread\n"
+        "  -j count     Number of threads encoding images\n"
+        "  -s           Split large images into bands\n"
+        "  -k count     Convert count segments of the session in parallel\n"
+        "  --follow     Wait for more at the end of the inputs, as tail -f\n"
+        "  -B, --batch manifest|pattern  Convert many recordings at once\n"
+        "  -P count     Number of recordings converted at once in a batch or server\n"
+        "  --serve socket    Convert the jobs sent to a Unix socket\n"
+        "  -Q count     Number of jobs waiting for the server, at most\n"
+        "  --connect socket  Have the server listening on socket convert\n"
+        "  --record     Record a command run on a new terminal\n"
         "  -v           Verbose mode (show parser logs)\n"
-    , name);
+    , name, name, name, name);
 }
 
 void
-set_defaults()
+set_defaults(Options *o)
 {
-    options.height = 0;
-    options.width = 0;
-    options.output = "con.gif";
-    options.maxdelay = FLT_MAX;
-    options.divisor = 1.0;
-    options.loop = -1;
-    options.font = 0;
-    options.cursor = 1;
-    options.quiet = 0;
-    options.barsize = 0;
+    o->height = 0;
+    o->width = 0;
+    o->output = "con.gif";
+    o->quiet = 0;
+    o->follow = 0;
+    o->segments = 1;
+    o->index = 0;
+    o->barsize = 0;
+    o->batch = 0;
+    o->workers = sysconf(_SC_NPROCESSORS_ONLN);
+    o->serve = o->connect = 0;
+    o->command = 0;
+    o->depth = 16;
+    o->font = o->palette = 0;
+    o->log = stderr;
+    o->dir = 0;
+    o->npaths = 0;
+    default_config(&o->cfg);
 }
 
-int
-main(int argc, char *argv[])
+/* Fonts are loaded once, and shared by all conversions that use them.
+ * Once the table is full, the least recently used font that no
+ * conversion holds makes room for a new one. */
+static struct {
+    char *fname;    /* NULL for a free slot */
+    Font *font;
+    int users;
+    long used;
+} fonts[MAX_FONTS];
+static long font_clock;
+
+/* Glyph caches kept warm by each worker of the server, by slot of the
+ * font, and for the built-in font in the last slot. */
+static Cache *(*warm)[MAX_FONTS+1];
+static int nwarm;
+
+/* Hold the font named fname, loading it if needed, until put_font().
+ * Return NULL on error, logged to log. */
+static Font *
+get_font(const char *fname, FILE *log)
 {
-    int opt;
-    int ret;
+    int i, slot = -1;
 
-    set_defaults();
-    options.has_winsize = 0;
-    if (ioctl(0, TIOCGWINSZ, &options.size) != -1) {
-        options.has_winsize = 1;
+    for (i = 0; i < MAX_FONTS; i++)
+        if (fonts[i].fname && !strcmp(fonts[i].fname, fname)) {
+            fonts[i].users++;
+            fonts[i].used = ++font_clock;
+            return fonts[i].font;
+        }
+    /* free slots were last used before any other */
+    for (i = 0; i < MAX_FONTS; i++)
+        if (!fonts[i].users && (slot == -1 || fonts[i].used < fonts[slot].used))
+            slot = i;
+    if (slot == -1) {
+        fprintf(log, "error: no more than %d fonts can be in use at once: %s\n",
+                MAX_FONTS, fname);
+        return NULL;
     }
-    while ((opt = getopt(argc, argv, "o:m:d:l:f:h:w:c:p:qv")) != -1) {
+    free(fonts[slot].fname);
+    free(fonts[slot].font);
+    for (i = 0; i < nwarm; i++) {
+        free(warm[i][slot]);
+        warm[i][slot] = NULL;
+    }
+    fonts[slot].fname = strdup(fname);
+    fonts[slot].font = fonts[slot].fname ? load_font(fname) : NULL;
+    if (!fonts[slot].font) {
+        free(fonts[slot].fname);
+        fonts[slot].fname = NULL;
+        fonts[slot].used = 0;
+        fprintf(log, "error: could not load font: %s\n", fname);
+        return NULL;
+    }
+    fonts[slot].users = 1;
+    fonts[slot].used = ++font_clock;
+    return fonts[slot].font;
+}
+
+/* Let go of a font held with get_font(). */
+static void
+put_font(Font *font)
+{
+    int i;
+
+    for (i = 0; i < MAX_FONTS; i++)
+        if (font && fonts[i].font == font)
+            fonts[i].users--;
+}
+
+/* Take the names given relative to o->dir, if set, and load the font and
+ * palette named. Return 0 on success, -1 on error. */
+static int
+load_options(Options *o)
+{
+    char **names[] = {&o->timings, &o->dialogue, &o->output, &o->index,
+                      &o->font, &o->palette};
+    char *name;
+    size_t i;
+
+    for (i = 0; o->dir && i < sizeof(names) / sizeof(names[0]); i++) {
+        name = *names[i];
+        if (!name || name[0] == '/' || (names[i] == &o->palette && name[0] == '@'))
+            continue;
+        *names[i] = o->paths[o->npaths++] = malloc(strlen(o->dir) + strlen(name) + 2);
+        if (!*names[i])
+            return -1;
+        sprintf(*names[i], "%s/%s", o->dir, name);
+    }
+    if (o->font) {
+        o->cfg.font = get_font(o->font, o->log);
+        if (!o->cfg.font)
+            return -1;
+    }
+    if (o->palette && load_palette(o->palette, o->cfg.plt) == -1) {
+        fprintf(o->log, "error: could not load palette: %s\n", o->palette);
+        if (o->font)
+            put_font(o->cfg.font);
+        return -1;
+    }
+    return 0;
+}
+
+/* options with no short form */
+enum { OPT_SERVE = 0x100, OPT_CONNECT, OPT_RECORD, OPT_FOLLOW };
+
+/* Parse options and the timings and dialogue, if any, on top of o. The
+ * font and palette are only named, see load_options().
+ * Return 0 on success, -1 on error. */
+static int
+parse_options(Options *o, int argc, char *argv[])
+{
+    int opt;
+    static struct option long_options[] = {
+        {"fps", required_argument, 0, 'F'},
+        {"start", required_argument, 0, 'S'},
+        {"end", required_argument, 0, 'E'},
+        {"index", required_argument, 0, 'x'},
+        {"batch", required_argument, 0, 'B'},
+        {"queue", required_argument, 0, 'Q'},
+        {"serve", required_argument, 0, OPT_SERVE},
+        {"connect", required_argument, 0, OPT_CONNECT},
+        {"record", no_argument, 0, OPT_RECORD},
+        {"follow", no_argument, 0, OPT_FOLLOW},
+        {0, 0, 0, 0}
+    };
+
+    optind = 1;
+    while ((opt = getopt_long(argc, argv, "o:m:d:l:r:F:S:E:x:B:P:Q:f:h:w:c:p:qbj:sk:v",
+                              long_options, NULL)) != -1) {
         switch (opt) {
         case 'o':
-            options.output = optarg;
+            o->output = optarg;
             break;
         case 'm':
-            options.maxdelay = atof(optarg);
+            o->cfg.maxdelay = US(MIN(atof(optarg), 1e12));
             break;
         case 'd':
-            options.divisor = atof(optarg);
+            o->cfg.divisor = atof(optarg);
             break;
         case 'l':
-            options.loop = atoi(optarg);
+            o->cfg.loop = atoi(optarg);
+            break;
+        case 'r':
+            o->cfg.rects = MAX(atoi(optarg), 1);
+            break;
+        case 'F':
+            o->cfg.fps = MIN(MAX(atoi(optarg), 0), MAX_FPS);
+            break;
+        case 'S':
+            o->cfg.start = US(MIN(MAX(atof(optarg), 0), 1e12));
+            break;
+        case 'E':
+            o->cfg.end = US(MIN(MAX(atof(optarg), 0), 1e12));
+            break;
+        case 'x':
+            o->index = optarg;
+            break;
+        case 'B':
+            o->batch = optarg;
+            break;
+        case 'P':
+            o->workers = MAX(atoi(optarg), 1);
             break;
         case 'f':
-            options.font = optarg;
+            o->font = optarg;
             break;
         case 'h':
-            options.height = atoi(optarg);
+            o->height = atoi(optarg);
             break;
         case 'w':
-            options.width = atoi(optarg);
+            o->width = atoi(optarg);
             break;
         case 'c':
             if (!strcmp(optarg, "on") || !strcmp(optarg, "1"))
-                options.cursor = 1;
+                o->cfg.cursor = 1;
             else if (!strcmp(optarg, "off") || !strcmp(optarg, "0"))
-                options.cursor = 0;
+                o->cfg.cursor = 0;
             break;
         case 'q':
-            options.quiet = 1;
+            o->quiet = 1;
+            break;
+        case 'b':
+            o->cfg.async = 1;
+            break;
+        case 'j':
+            o->cfg.threads = MAX(atoi(optarg), 0);
+            break;
+        case 's':
+            o->cfg.bands = 1;
+            break;
+        case 'k':
+            o->segments = MAX(atoi(optarg), 1);
             break;
         case 'v':
-            set_verbosity(1);
+            o->cfg.verbose = 1;
             break;
         case 'p':
-            set_default_palette(optarg);
+            o->palette = optarg;
+            break;
+        case 'Q':
+            o->depth = MAX(atoi(optarg), 1);
+            break;
+        case OPT_SERVE:
+            o->serve = optarg;
+            break;
+        case OPT_CONNECT:
+            o->connect = optarg;
+            break;
+        case OPT_FOLLOW:
+            o->follow = 1;
+            break;
+        case OPT_RECORD:
+            o->command = argv;
             break;
         default:
-            help(argv[0]);
-            return 1;
+            /* getopt's own messages stay with the server */
+            if (o->dir)
+                fprintf(o->log, "error: bad option\n");
+            return -1;
+        }
+    }
+    if (o->cfg.end && o->cfg.end <= o->cfg.start) {
+        fprintf(o->log, "error: the end must come after the start\n");
+        return -1;
+    }
+    if (o->command) {
+        /* the rest is the command, after "--" */
+        o->command = &argv[optind];
+        if (optind == argc) {
+            fprintf(o->log, "error: no command to record\n");
+            return -1;
         }
+        return 0;
+    }
+    if (optind < argc)
+        o->timings = argv[optind++];
+    if (optind < argc)
+        o->dialogue = argv[optind++];
+    if (optind < argc) {
+        fprintf(o->log, "error: too many arguments\n");
+        return -1;
+    }
+    return 0;
+}
+
+/* Copy of s with its extension, if any, replaced by ext. */
+static char *
+with_ext(const char *s, const char *ext)
+{
+    const char *base = strrchr(s, '/'), *dot;
+    char *name;
+    size_t len;
+
+    dot = strrchr(base ? base : s, '.');
+    len = dot && dot != (base ? base+1 : s) ? (size_t) (dot - s) : strlen(s);
+    name = malloc(len + strlen(ext) + 1);
+    if (name) {
+        memcpy(name, s, len);
+        strcpy(&name[len], ext);
+    }
+    return name;
+}
+
+/* Jobs of a batch: every line of a manifest holds the arguments of one
+ * conversion, as on the command line, on top of the batch's options;
+ * blank lines and lines starting with '#' are skipped. A name that is not
+ * a regular file is instead a pattern matching timings files, each of which goes with the dialogue of the same
+ * name without extension. The GIF is named after the dialogue unless -o
+ * is given. Return the number of jobs, or -1 on error. */
+static int
+read_batch(Options *batch, Options **jobs, char **text)
+{
+    Options *job, *more;
+    glob_t matches;
+    struct stat st;
+    char *argv[0x40], *line, *next;
+    long size;
+    size_t i;
+    int argc, njobs = 0, cap = 0;
+    FILE *f;
+
+    *jobs = NULL;
+    *text = NULL;
+    /* a manifest may well have wildcards in its name */
+    if (stat(batch->batch, &st) == -1 || !S_ISREG(st.st_mode)) {
+        if (glob(batch->batch, 0, NULL, &matches)) {
+            fprintf(stderr, "error: no batch or recordings found: %s\n", batch->batch);
+            return -1;
+        }
+        /* the names are kept along with the manifest text */
+        size = 0;
+        for (i = 0; i < matches.gl_pathc; i++)
+            size += 2 * strlen(matches.gl_pathv[i]) + 2;
+        *text = malloc(size + 1);
+        *jobs = calloc(matches.gl_pathc + 1, sizeof(**jobs));
+        if (!*text || !*jobs) {
+            globfree(&matches);
+            return -1;
+        }
+        next = *text;
+        for (i = 0; i < matches.gl_pathc; i++) {
+            job = &(*jobs)[njobs];
+            *job = *batch;
+            job->font = job->palette = NULL;
+            job->timings = strcpy(next, matches.gl_pathv[i]);
+            next += strlen(next) + 1;
+            line = with_ext(job->timings, "");
+            if (!line || !strcmp(line, job->timings)) {
+                free(line);
+                continue;
+            }
+            job->dialogue = strcpy(next, line);
+            next += strlen(next) + 1;
+            free(line);
+            job->output = NULL;
+            njobs++;
+        }
+        globfree(&matches);
+    } else {
+        f = fopen(batch->batch, "r");
+        if (!f) {
+            fprintf(stderr, "error: could not load batch: %s\n", batch->batch);
+            return -1;
+        }
+        fseek(f, 0, SEEK_END);
+        size = ftell(f);
+        rewind(f);
+        *text = malloc(size + 1);
+        if (!*text || fread(*text, 1, size, f) != (size_t) size) {
+            fclose(f);
+            return -1;
+        }
+        fclose(f);
+        (*text)[size] = '\0';
+        for (line = *text; line; line = next) {
+            next = strchr(line, '\n');
+            if (next)
+                *next++ = '\0';
+            argv[0] = "congif";
+            for (argc = 1; argc < 0x40 && (argv[argc] = strtok(argc > 1 ? NULL : line, " \t\r")); argc++);
+            if (argc == 1 || argv[1][0] == '#')
+                continue;
+            if (njobs == cap) {
+                cap = cap ? 2*cap : 0x40;
+                more = realloc(*jobs, cap * sizeof(**jobs));
+                if (!more)
+                    return -1;
+                *jobs = more;
+            }
+            job = &(*jobs)[njobs];
+            *job = *batch;
+            job->timings = job->dialogue = job->output = NULL;
+            job->font = job->palette = NULL;
+            /* a followed job would never end */
+            if (parse_options(job, argc, argv) == -1 || !job->dialogue ||
+                job->follow || load_options(job) == -1) {
+                fprintf(stderr, "error: bad job in batch: %s\n", argv[1]);
+                return -1;
+            }
+            njobs++;
+        }
+    }
+    return njobs;
+}
+
+static int
+convert_job(void *arg)
+{
+    return convert_script(arg);
+}
+
+static double
+seconds()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Convert every job of the batch on a pool of workers, then report how
+ * much was converted and how fast. */
+static int
+convert_batch(Options *batch)
+{
+    Options *jobs;
+    void **args = NULL;
+    uint64_t *costs = NULL, in = 0, out = 0;
+    int64_t played = 0;
+    char *text, **names = NULL;
+    struct stat st;
+    double start, wall;
+    int i, njobs, failed = -1;
+
+    njobs = read_batch(batch, &jobs, &text);
+    if (njobs < 0)
+        goto no_jobs;
+    args = malloc((njobs + 1) * sizeof(*args));
+    costs = malloc((njobs + 1) * sizeof(*costs));
+    names = calloc(njobs + 1, sizeof(*names));
+    if (!args || !costs || !names)
+        goto no_jobs;
+    for (i = 0; i < njobs; i++) {
+        if (!jobs[i].output)
+            jobs[i].output = names[i] = with_ext(jobs[i].dialogue, ".gif");
+        if (!jobs[i].output)
+            goto no_jobs;
+        jobs[i].barsize = 0;
+        args[i] = &jobs[i];
+        costs[i] = stat(jobs[i].dialogue, &st) == -1 ? 0 : st.st_size;
     }
-    if (optind >= argc - 1) {
-        fprintf(stderr, "error: no input given\n");
+    start = seconds();
+    failed = run_batch(args, costs, njobs, batch->workers, convert_job);
+    wall = seconds() - start;
+    if (failed == -1) {
+        fprintf(stderr, "error: could not start batch\n");
+        goto no_jobs;
+    }
+    for (i = 0; i < njobs; i++) {
+        in += jobs[i].bytes_in;
+        out += jobs[i].bytes_out;
+        played += jobs[i].played;
+    }
+    if (!batch->quiet) {
+        printf("%d recordings converted in %.2f s, %d at a time, %d failed\n",
+               njobs, wall, MIN(MAX(batch->workers, 1), MAX(njobs, 1)), failed);
+        printf("%.1f MB read, %.1f MB of GIF written, %.1f MB/s\n",
+               in / 1e6, out / 1e6, wall > 0 ? in / 1e6 / wall : 0);
+        printf("%.1f s of sessions, %.1f times real time\n",
+               played / 1e6, wall > 0 ? played / 1e6 / wall : 0);
+    }
+no_jobs:
+    if (names)
+        for (i = 0; i < njobs; i++)
+            free(names[i]);
+    free(names);
+    free(costs);
+    free(args);
+    free(jobs);
+    free(text);
+    return failed ? 1 : 0;
+}
+
+/* getopt() and the fonts are shared by the jobs of the server. */
+static pthread_mutex_t options_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Convert a job sent to the server, on top of the server's options, with
+ * the glyph caches of worker id. */
+static int
+serve_job(int id, Request *req, FILE *log, Reply *reply)
+{
+    Options o = options;
+    Cache **w = warm[id];
+    int i, loaded = 0, ret = 1;
+
+    o.timings = o.dialogue = o.index = NULL;
+    o.output = "con.gif";
+    o.font = o.palette = NULL;
+    o.serve = o.connect = NULL;
+    o.command = NULL;
+    o.log = log;
+    o.dir = req->dir;
+    o.npaths = 0;
+    o.has_winsize = req->rows > 0 && req->cols > 0;
+    o.size.ws_row = req->rows;
+    o.size.ws_col = req->cols;
+    pthread_mutex_lock(&options_lock);
+    if (parse_options(&o, req->argc, req->argv) == 0 && load_options(&o) == 0) {
+        for (i = 0; i < MAX_FONTS && fonts[i].font != o.cfg.font; i++);
+        if (!w[i] && o.cfg.font)
+            w[i] = new_cache(o.cfg.font);
+        o.warm = w[i];
+        loaded = 1;
+    }
+    pthread_mutex_unlock(&options_lock);
+    if (!loaded)
+        goto no_job;
+    if (o.batch || o.serve || o.command || o.follow) {
+        fprintf(log, "error: only conversions that end can be sent to a server\n");
+        goto no_job;
+    }
+    if (!o.dialogue) {
+        fprintf(log, "error: no input given\n");
+        goto no_job;
+    }
+    ret = convert_script(&o);
+    reply->bytes_in = o.bytes_in;
+    reply->bytes_out = o.bytes_out;
+    reply->played = o.played;
+no_job:
+    if (loaded && o.font) {
+        pthread_mutex_lock(&options_lock);
+        put_font(o.cfg.font);
+        pthread_mutex_unlock(&options_lock);
+    }
+    for (i = 0; i < o.npaths; i++)
+        free(o.paths[i]);
+    return ret;
+}
+
+static int
+serve_jobs(Options *o)
+{
+    int i, j, ret;
+
+    warm = calloc(o->workers, sizeof(*warm));
+    if (!warm)
+        return 1;
+    nwarm = o->workers;
+    /* messages go to each client instead */
+    opterr = 0;
+    ret = serve(o->serve, o->workers, o->depth, serve_job);
+    for (i = 0; i < o->workers; i++)
+        for (j = 0; j < MAX_FONTS+1; j++)
+            free(warm[i][j]);
+    free(warm);
+    return ret;
+}
+
+/* Have the server at path convert what is on the command line. Return
+ * the status of the job, or -1 if the server could not take it. */
+static int
+convert_remote(const char *path, int argc, char *argv[])
+{
+    char dir[PATH_MAX];
+    Request req;
+    Reply reply;
+
+    if (!getcwd(dir, sizeof(dir)))
+        return -1;
+    req.argc = argc;
+    req.argv = argv;
+    req.dir = dir;
+    req.rows = options.has_winsize ? options.size.ws_row : 0;
+    req.cols = options.has_winsize ? options.size.ws_col : 0;
+    if (send_job(path, &req, &reply, 2) == -1) {
+        if (options.connect)
+            fprintf(stderr, "error: could not reach server: %s\n", path);
+        return -1;
+    }
+    if (reply.status == JOB_BUSY) {
+        if (options.connect)
+            fprintf(stderr, "error: server is busy: %s\n", path);
+        return -1;
+    }
+    if (!options.quiet)
+        printf("converted in %.2f s, %.2f s in queue, %.1f MB read, %.1f MB written\n",
+               reply.took / 1e6, reply.queued / 1e6,
+               reply.bytes_in / 1e6, reply.bytes_out / 1e6);
+    return reply.status;
+}
+
+int
+main(int argc, char *argv[])
+{
+    struct sigaction sa;
+    char *sock;
+    int i, ret;
+
+    set_defaults(&options);
+    options.has_winsize = 0;
+    if (ioctl(0, TIOCGWINSZ, &options.size) != -1) {
+        options.has_winsize = 1;
+    }
+    if (parse_options(&options, argc, argv) == -1) {
         help(argv[0]);
         return 1;
     }
-    options.timings = argv[optind++];
-    options.dialogue = argv[optind++];
-    if (!options.quiet && options.has_winsize)
-        options.barsize = options.size.ws_col - 1;
-    ret = convert_script();
+    /* conversions go to the server given, or to the one named by
+     * CONGIF_SOCKET as long as it takes them */
+    if (options.connect && (options.batch || options.serve || options.command ||
+        options.follow)) {
+        fprintf(stderr, "error: only conversions that end can be sent to a server\n");
+        return 1;
+    }
+    sock = options.connect ? options.connect : getenv("CONGIF_SOCKET");
+    if (sock && sock[0] && options.dialogue && !options.batch && !options.serve &&
+        !options.command && !options.follow) {
+        ret = convert_remote(sock, argc, argv);
+        if (ret != -1 || options.connect)
+            return ret == -1 ? 1 : ret;
+    }
+    if (load_options(&options) == -1)
+        return 1;
+    if (options.serve) {
+        if (options.timings || options.batch) {
+            fprintf(stderr, "error: a server takes its input from clients\n");
+            ret = 1;
+        } else if (options.follow) {
+            fprintf(stderr, "error: a server cannot follow its jobs' inputs\n");
+            ret = 1;
+        } else if (options.index) {
+            fprintf(stderr, "error: an index can only be given per recording\n");
+            ret = 1;
+        } else {
+            ret = serve_jobs(&options);
+        }
+    } else if (options.command) {
+        if (options.timings || options.batch || options.index ||
+            options.segments > 1) {
+            fprintf(stderr, "error: a recording takes no input, index or segments\n");
+            ret = 1;
+        } else {
+            ret = record_session(&options);
+        }
+    } else if (options.batch) {
+        if (options.timings) {
+            fprintf(stderr, "error: no input is given with a batch\n");
+            return 1;
+        }
+        if (options.follow) {
+            fprintf(stderr, "error: the recordings of a batch cannot be followed\n");
+            return 1;
+        }
+        if (options.index) {
+            fprintf(stderr, "error: an index can only be given per recording\n");
+            return 1;
+        }
+        ret = convert_batch(&options);
+    } else {
+        if (!options.dialogue) {
+            fprintf(stderr, "error: no input given\n");
+            help(argv[0]);
+            return 1;
+        }
+        if (!options.quiet && options.has_winsize && strcmp(options.output, "-"))
+            options.barsize = options.size.ws_col - 1;
+        if (options.segments <= 1) {
+            /* the first signal finishes the GIF, the next one is fatal */
+            memset(&sa, 0, sizeof(sa));
+            sa.sa_handler = on_signal;
+            sa.sa_flags = SA_RESETHAND;
+            sigemptyset(&sa.sa_mask);
+            sigaction(SIGINT, &sa, NULL);
+            sigaction(SIGTERM, &sa, NULL);
+        }
+        ret = convert_script(&options);
+    }
+    for (i = 0; i < MAX_FONTS; i++) {
+        free(fonts[i].fname);
+        free(fonts[i].font);
+    }
     return ret;
 }
@@ -8,6 +8,58 @@
 #include <fcntl.h>
 
 #include "mbf.h"
+#include "simd.h"
+
+/* Number of pages needed for the page table: one for each page of 256 code
+ * points with glyphs, plus one shared by the pages without any. */
+static int
+count_pages(Range *ranges, int nr)
+{
+    int i, page, last, end;
+    int n = 1;
+
+    last = -1;
+    for (i = 0; i < nr; i++) {
+        if (!ranges[i].length)
+            continue;
+        end = ranges[i].offset + ranges[i].length - 1;
+        for (page = ranges[i].offset >> 8; page <= end >> 8 && page < 0x100; page++) {
+            if (page != last)
+                n++;
+            last = page;
+        }
+    }
+    return n;
+}
+
+static void
+index_font(Font *font, uint16_t *table)
+{
+    uint16_t *blank = table;
+    uint16_t codes[] = {0xFFFD, 0x003F, 0x0020};
+    int fallback = -1;
+    int i, code, index, end;
+
+    for (i = 0; i < 3 && fallback == -1; i++)
+        fallback = search_glyph(font, codes[i]);
+    for (i = 0; i < 0x100; i++)
+        blank[i] = fallback == -1 ? NO_GLYPH : fallback;
+    for (i = 0; i < 0x100; i++)
+        font->pages[i] = blank;
+    index = 0;
+    for (i = 0; i < font->header.nr; i++) {
+        code = font->ranges[i].offset;
+        end = code + font->ranges[i].length;
+        for (; code < end && code < 0x10000; code++, index++) {
+            if (font->pages[code >> 8] == blank) {
+                table += 0x100;
+                memcpy(table, blank, 0x100 * sizeof(*table));
+                font->pages[code >> 8] = table;
+            }
+            font->pages[code >> 8][code & 0xFF] = index;
+        }
+    }
+}
 
 Font *
 load_font(const char *fname)
@@ -16,7 +68,8 @@ load_font(const char *fname)
     char sig[4];
     Header header;
     int stride;
-    size_t ranges_size, data_size;
+    size_t ranges_size, pages_size, data_size;
+    Range *ranges;
     Font *font;
 
     fd = open(fname, O_RDONLY);
@@ -31,22 +84,48 @@ load_font(const char *fname)
     /* stride = ceil(w / 8) = floor(w / 8) + (w % 8 ? 1 : 0) */
     stride = (header.w >> 3) + !!(header.w & 7);
     ranges_size = header.nr * sizeof(Range);
+    ranges = malloc(ranges_size);
+    if (!ranges) {
+        close(fd);
+        return NULL;
+    }
+    read(fd, ranges, ranges_size);
+    pages_size = count_pages(ranges, header.nr) * 0x100 * sizeof(uint16_t);
     data_size = header.ng * stride * header.h;
-    font = malloc(sizeof(Font) + ranges_size + data_size);
+    font = malloc(sizeof(Font) + ranges_size + pages_size + data_size);
     if (!font) {
+        free(ranges);
         close(fd);
         return NULL;
     }
     font->stride = stride;
     font->header = header;
     font->ranges = (Range *) &font[1];
-    read(fd, font->ranges, ranges_size);
-    font->data = (uint8_t *) &font->ranges[header.nr];
+    memcpy(font->ranges, ranges, ranges_size);
+    free(ranges);
+    font->data = (uint8_t *) &font->ranges[header.nr] + pages_size;
     read(fd, font->data, data_size);
     close(fd);
+    index_font(font, (uint16_t *) &font->ranges[header.nr]);
     return font;
 }
 
+/* Build the page table of a font that was not loaded with load_font(),
+ * such as the compiled-in default font. */
+int
+init_font(Font *font)
+{
+    uint16_t *table;
+
+    if (font->pages[0])
+        return 0;
+    table = malloc(count_pages(font->ranges, font->header.nr) * 0x100 * sizeof(uint16_t));
+    if (!table)
+        return -1;
+    index_font(font, table);
+    return 0;
+}
+
 int
 search_glyph(Font *font, uint16_t code)
 {
@@ -68,14 +147,44 @@ search_glyph(Font *font, uint16_t code)
 int
 get_index(Font *font, uint16_t code)
 {
-    int index;
-    uint16_t *cur_code;
-    uint16_t codes[] = {code, 0xFFFD, 0x003F, 0x0020, 0};
+    uint16_t index = font->pages[code >> 8][code & 0xFF];
+    return index == NO_GLYPH ? -1 : index;
+}
+
+Cache *
+new_cache(Font *font)
+{
+    int i;
+    int size = font->header.w * font->header.h;
+    Cache *cache = malloc(sizeof(Cache) + CACHE_SLOTS * size);
+    if (!cache)
+        return NULL;
+    cache->font = font;
+    cache->size = size;
+    for (i = 0; i < CACHE_SLOTS; i++)
+        cache->tags[i] = -1;
+    cache->masks = (uint8_t *) &cache[1];
+    return cache;
+}
 
-    for (cur_code = &codes[0]; *cur_code; cur_code++) {
-        index = search_glyph(font, *cur_code);
-        if (index != -1)
-            break;
-    };
-    return index;
+uint8_t *
+get_mask(Cache *cache, int index)
+{
+    Font *font = cache->font;
+    int slot = index % CACHE_SLOTS;
+    uint8_t *mask = &cache->masks[slot * cache->size];
+    uint8_t *strip, *m;
+    int i;
+
+    if (cache->tags[slot] == index)
+        return mask;
+    strip = &font->data[font->stride * font->header.h * index];
+    m = mask;
+    for (i = 0; i < font->header.h; i++) {
+        expand_bits(m, strip, font->header.w);
+        m += font->header.w;
+        strip += font->stride;
+    }
+    cache->tags[slot] = index;
+    return mask;
 }
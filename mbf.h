@@ -1,3 +1,8 @@
+#ifndef CONGIF_MBF_H
+#define CONGIF_MBF_H
+
+#include <stdint.h>
+
 typedef struct Header {
     uint16_t ng;
     uint8_t w, h;
@@ -8,13 +13,35 @@ typedef struct Range {
     uint16_t offset, length;
 } Range;
 
+#define NO_GLYPH    0xFFFF
+
 typedef struct Font {
     Header header;
     int stride;
     Range *ranges;
     uint8_t *data;
+    /* glyph index of each BMP code point, by page of 256 codes; code points
+     * without a glyph map to the fallback glyph, or NO_GLYPH if none */
+    uint16_t *pages[0x100];
 } Font;
 
+#define CACHE_SLOTS 0x100
+
+/* Glyphs expanded to one byte per pixel (0xFF if set, 0x00 if not), so that
+ * they can be drawn in any colour pair by masking. Glyph i is kept in slot
+ * i % CACHE_SLOTS until another glyph needs that slot. */
+typedef struct Cache {
+    Font *font;
+    int size;
+    int tags[CACHE_SLOTS];
+    uint8_t *masks;
+} Cache;
+
 Font *load_font(const char *fname);
+int init_font(Font *font);
 int search_glyph(Font *font, uint16_t code);
 int get_index(Font *font, uint16_t code);
+Cache *new_cache(Font *font);
+uint8_t *get_mask(Cache *cache, int index);
+
+#endif
@@ -47,13 +47,13 @@ main(int argc, char *argv[])
 
     printf("Font "FN"[1] = {{ ");
 
-    printf("{ %d, %d, %d, %d }, ",
+    printf(".header = { %d, %d, %d, %d }, ",
         (int) font->header.ng,
         (int) font->header.w,
         (int) font->header.h,
         (int) font->header.nr);
 
-    printf("%d, "FN"_ranges, "FN"_data }};\n",
+    printf(".stride = %d, .ranges = "FN"_ranges, .data = "FN"_data }};\n",
         (int) font->stride);
 
     free(font);
@@ -0,0 +1,261 @@
+#define _XOPEN_SOURCE 600
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <termios.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/ioctl.h>
+
+#include "record.h"
+
+#define BLOCK   0x4000
+
+/* Output read from the terminal, waiting to be taken. */
+typedef struct Chunk {
+    struct Chunk *next;
+    int64_t us;     /* since the previous chunk */
+    size_t len;
+    uint8_t data[];
+} Chunk;
+
+/* Chunks go from the thread reading the terminal to the one taking
+ * them, so that the command never waits for frames to be encoded. */
+typedef struct Queue {
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    Chunk *head, *tail;
+    int done;
+    TakeFunc take;
+    void *arg;
+} Queue;
+
+static int64_t
+now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int
+write_all(int fd, const uint8_t *data, size_t len)
+{
+    ssize_t n;
+
+    while (len > 0) {
+        n = write(fd, data, len);
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return -1;
+        data += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/* Take the chunks queued so far, all at once. */
+static void *
+take_chunks(void *arg)
+{
+    Queue *q = arg;
+    Chunk *chunk, *next;
+    int done;
+
+    do {
+        pthread_mutex_lock(&q->lock);
+        while (!q->head && !q->done)
+            pthread_cond_wait(&q->ready, &q->lock);
+        chunk = q->head;
+        q->head = q->tail = NULL;
+        done = q->done;
+        pthread_mutex_unlock(&q->lock);
+        for (; chunk; chunk = next) {
+            next = chunk->next;
+            q->take(q->arg, chunk->us, chunk->data, chunk->len);
+            free(chunk);
+        }
+    } while (!done);
+    return NULL;
+}
+
+static void
+put_chunk(Queue *q, Chunk *chunk)
+{
+    pthread_mutex_lock(&q->lock);
+    if (q->tail)
+        q->tail->next = chunk;
+    else
+        q->head = chunk;
+    q->tail = chunk;
+    pthread_cond_signal(&q->ready);
+    pthread_mutex_unlock(&q->lock);
+}
+
+static void
+make_raw(struct termios *t)
+{
+    t->c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+    t->c_oflag &= ~OPOST;
+    t->c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    t->c_cflag &= ~(CSIZE | PARENB);
+    t->c_cflag |= CS8;
+    t->c_cc[VMIN] = 1;
+    t->c_cc[VTIME] = 0;
+}
+
+/* Run the command in argv on a new terminal of the given size, showing
+ * its output and passing it our input as if it ran on our own terminal.
+ * Each piece of output is also handed to take along with arg, and the
+ * microseconds since the previous one, from another thread. Return 0
+ * once the command has exited, with its exit status in status, or -1 if
+ * it could not be run or its output could not all be taken. */
+int
+record(char **argv, int rows, int cols, TakeFunc take, void *arg,
+       int *status)
+{
+    struct winsize size;
+    struct termios saved, raw;
+    struct pollfd fds[2];
+    pthread_t thread;
+    Queue q;
+    Chunk *chunk;
+    uint8_t buf[BLOCK];
+    char *name;
+    pid_t pid;
+    int master, slave, tty, nfds, wstatus, failed = 0, ret = -1;
+    int64_t last, now;
+    ssize_t n;
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master == -1 || grantpt(master) == -1 || unlockpt(master) == -1 ||
+        !(name = ptsname(master))) {
+        fprintf(stderr, "error: could not open a terminal\n");
+        goto no_master;
+    }
+    memset(&size, 0, sizeof(size));
+    size.ws_row = rows;
+    size.ws_col = cols;
+    tty = tcgetattr(0, &saved) == 0;
+    fflush(stdout);
+    pid = fork();
+    if (pid == -1) {
+        fprintf(stderr, "error: could not start command\n");
+        goto no_master;
+    }
+    if (pid == 0) {
+        setsid();
+        slave = open(name, O_RDWR);
+        if (slave == -1)
+            _exit(127);
+#ifdef TIOCSCTTY
+        ioctl(slave, TIOCSCTTY, 0);
+#endif
+        if (tty)
+            tcsetattr(slave, TCSANOW, &saved);
+        ioctl(slave, TIOCSWINSZ, &size);
+        dup2(slave, 0);
+        dup2(slave, 1);
+        dup2(slave, 2);
+        if (slave > 2)
+            close(slave);
+        close(master);
+        execvp(argv[0], argv);
+        fprintf(stderr, "error: could not run %s\n", argv[0]);
+        _exit(127);
+    }
+
+    pthread_mutex_init(&q.lock, NULL);
+    pthread_cond_init(&q.ready, NULL);
+    q.head = q.tail = NULL;
+    q.done = 0;
+    q.take = take;
+    q.arg = arg;
+    if (pthread_create(&thread, NULL, take_chunks, &q)) {
+        fprintf(stderr, "error: could not start recording\n");
+        kill(pid, SIGHUP);
+        waitpid(pid, NULL, 0);
+        goto no_thread;
+    }
+    if (tty) {
+        raw = saved;
+        make_raw(&raw);
+        tcsetattr(0, TCSAFLUSH, &raw);
+    }
+
+    fds[0] = (struct pollfd) {master, POLLIN, 0};
+    fds[1] = (struct pollfd) {0, POLLIN, 0};
+    nfds = 2;
+    last = now_us();
+    for (;;) {
+        if (poll(fds, nfds, -1) == -1) {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        if (nfds > 1 && fds[1].revents) {
+            n = read(0, buf, sizeof(buf));
+            if (n == -1 && errno == EINTR)
+                continue;
+            /* input that is not a terminal ends with an end of file */
+            if (n == 0 && !tty)
+                write_all(master, (uint8_t *) "\4", 1);
+            if (n <= 0 || write_all(master, buf, n) == -1)
+                nfds = 1;
+        }
+        if (fds[0].revents) {
+            /* EIO once the command and its children are gone */
+            n = read(master, buf, sizeof(buf));
+            if (n == -1 && errno == EINTR)
+                continue;
+            if (n <= 0)
+                break;
+            now = now_us();
+            /* output that cannot be kept would leave the GIF astray */
+            chunk = malloc(sizeof(*chunk) + n);
+            if (!chunk) {
+                failed = 1;
+                break;
+            }
+            write_all(1, buf, n);
+            chunk->next = NULL;
+            chunk->us = now - last;
+            chunk->len = n;
+            memcpy(chunk->data, buf, n);
+            put_chunk(&q, chunk);
+            last = now;
+        }
+    }
+
+    if (tty)
+        tcsetattr(0, TCSAFLUSH, &saved);
+    if (failed) {
+        fprintf(stderr, "error: out of memory, recording stopped\n");
+        kill(pid, SIGHUP);
+    }
+    pthread_mutex_lock(&q.lock);
+    q.done = 1;
+    pthread_cond_signal(&q.ready);
+    pthread_mutex_unlock(&q.lock);
+    pthread_join(thread, NULL);
+    while (waitpid(pid, &wstatus, 0) == -1 && errno == EINTR);
+    *status = WIFEXITED(wstatus) ? WEXITSTATUS(wstatus) : 128 + WTERMSIG(wstatus);
+    ret = failed ? -1 : 0;
+no_thread:
+    pthread_cond_destroy(&q.ready);
+    pthread_mutex_destroy(&q.lock);
+no_master:
+    if (master != -1)
+        close(master);
+    return ret;
+}
@@ -0,0 +1,7 @@
+#include <stdint.h>
+#include <stddef.h>
+
+typedef void (*TakeFunc)(void *arg, int64_t us, const uint8_t *data, size_t len);
+
+int record(char **argv, int rows, int cols, TakeFunc take, void *arg,
+           int *status);
@@ -0,0 +1,369 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "serve.h"
+
+#define MAX_REQUEST 0x10000
+#define MAX_ARGS    0x100
+/* seconds a client has to send its request */
+#define TIMEOUT     10
+
+/* What a client sends first: the length of what follows, the number of
+ * arguments and the size of its terminal. The directory and each argument
+ * follow, NUL-terminated. */
+typedef struct Header {
+    uint32_t len;
+    int32_t argc;
+    uint16_t rows, cols;
+} Header;
+
+typedef struct Job {
+    int fd;
+    int64_t since;
+} Job;
+
+/* Connections waiting for a worker, in a ring of depth slots. */
+typedef struct Server {
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    Job *queue;
+    int depth, head, count;
+    int stop;
+    JobFunc work;
+} Server;
+
+typedef struct Worker {
+    pthread_t thread;
+    Server *server;
+    int id;
+} Worker;
+
+static volatile sig_atomic_t stopping;
+
+static void
+on_signal(int sig)
+{
+    (void) sig;
+    stopping = 1;
+}
+
+static int64_t
+now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int
+send_all(int fd, const void *buf, size_t len)
+{
+    const uint8_t *p = buf;
+    ssize_t n;
+
+    while (len > 0) {
+        n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+static int
+recv_all(int fd, void *buf, size_t len)
+{
+    uint8_t *p = buf;
+    ssize_t n;
+
+    while (len > 0) {
+        n = recv(fd, p, len, 0);
+        if (n == -1 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return -1;
+        p += n;
+        len -= n;
+    }
+    return 0;
+}
+
+/* Read the request of a connection, run it and send back the reply.
+ * Connections with a bad request are closed without a reply. */
+static void
+run_job(Server *server, int id, Job *job)
+{
+    struct timeval tv = {TIMEOUT, 0};
+    Header h;
+    Request req;
+    Reply reply;
+    char *text = NULL, *end, *next, **argv = NULL, *log_text = NULL;
+    size_t loglen = 0;
+    FILE *log;
+    int64_t start;
+    int i;
+
+    memset(&reply, 0, sizeof(reply));
+    start = now_us();
+    reply.queued = start - job->since;
+    setsockopt(job->fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    if (recv_all(job->fd, &h, sizeof(h)) == -1 || h.len > MAX_REQUEST ||
+        h.argc < 1 || h.argc > MAX_ARGS)
+        goto no_request;
+    text = malloc(h.len + 1);
+    argv = malloc((h.argc + 1) * sizeof(*argv));
+    if (!text || !argv || recv_all(job->fd, text, h.len) == -1)
+        goto no_request;
+    text[h.len] = '\0';
+    end = &text[h.len];
+    req.dir = text;
+    next = text + strlen(text) + 1;
+    for (i = 0; i < h.argc; i++) {
+        if (next >= end)
+            goto no_request;
+        argv[i] = next;
+        next += strlen(next) + 1;
+    }
+    argv[h.argc] = NULL;
+    req.argc = h.argc;
+    req.argv = argv;
+    req.rows = h.rows;
+    req.cols = h.cols;
+    log = open_memstream(&log_text, &loglen);
+    if (!log)
+        goto no_request;
+    reply.status = server->work(id, &req, log, &reply);
+    fclose(log);
+    reply.took = now_us() - start;
+    reply.loglen = loglen;
+    if (send_all(job->fd, &reply, sizeof(reply)) == 0)
+        send_all(job->fd, log_text, loglen);
+    free(log_text);
+no_request:
+    free(argv);
+    free(text);
+    close(job->fd);
+}
+
+static void *
+run_worker(void *arg)
+{
+    Worker *worker = arg;
+    Server *server = worker->server;
+    Job job;
+
+    pthread_mutex_lock(&server->lock);
+    for (;;) {
+        while (!server->count && !server->stop)
+            pthread_cond_wait(&server->ready, &server->lock);
+        /* jobs still queued are run before stopping */
+        if (!server->count)
+            break;
+        job = server->queue[server->head];
+        server->head = (server->head + 1) % server->depth;
+        server->count--;
+        pthread_mutex_unlock(&server->lock);
+        run_job(server, worker->id, &job);
+        pthread_mutex_lock(&server->lock);
+    }
+    pthread_mutex_unlock(&server->lock);
+    return NULL;
+}
+
+/* Serve jobs on the Unix socket at path until SIGINT or SIGTERM, running
+ * work on up to nworkers of them at once, with id telling the workers
+ * apart. Up to depth more wait for a worker; the rest are turned away as
+ * busy. Return 0 once every job taken has been run, 1 on error. */
+int
+serve(const char *path, int nworkers, int depth, JobFunc work)
+{
+    struct sockaddr_un addr;
+    struct sigaction sa;
+    struct stat st;
+    Server server;
+    Worker *workers;
+    Reply busy;
+    Job job;
+    mode_t mask;
+    int fd, probe, bound, conn, i, n, ret = 1;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "error: socket name too long: %s\n", path);
+        goto no_socket;
+    }
+    strcpy(addr.sun_path, path);
+    /* a socket left by a server that is gone is replaced */
+    probe = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (probe != -1 && connect(probe, (struct sockaddr *) &addr, sizeof(addr)) == 0) {
+        fprintf(stderr, "error: already served: %s\n", path);
+        close(probe);
+        goto no_socket;
+    }
+    if (probe != -1)
+        close(probe);
+    if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+        unlink(path);
+    /* jobs run with our rights, so only we may connect */
+    mask = umask(0177);
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    bound = fd != -1 && bind(fd, (struct sockaddr *) &addr, sizeof(addr)) == 0;
+    umask(mask);
+    if (!bound || listen(fd, depth) == -1) {
+        fprintf(stderr, "error: could not serve: %s\n", path);
+        goto no_listen;
+    }
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = on_signal;
+    sigemptyset(&sa.sa_mask);
+    /* without SA_RESTART, so that accept() is interrupted */
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    nworkers = nworkers < 1 ? 1 : nworkers;
+    depth = depth < 1 ? 1 : depth;
+    pthread_mutex_init(&server.lock, NULL);
+    pthread_cond_init(&server.ready, NULL);
+    server.queue = malloc(depth * sizeof(*server.queue));
+    server.depth = depth;
+    server.head = server.count = 0;
+    server.stop = 0;
+    server.work = work;
+    workers = calloc(nworkers, sizeof(*workers));
+    if (!server.queue || !workers)
+        goto no_workers;
+    for (n = 0; n < nworkers; n++) {
+        workers[n].server = &server;
+        workers[n].id = n;
+        if (pthread_create(&workers[n].thread, NULL, run_worker, &workers[n]))
+            break;
+    }
+    if (!n) {
+        fprintf(stderr, "error: could not start workers\n");
+        goto no_workers;
+    }
+
+    memset(&busy, 0, sizeof(busy));
+    busy.status = JOB_BUSY;
+    ret = 0;
+    while (!stopping) {
+        conn = accept(fd, NULL, NULL);
+        if (conn == -1) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            fprintf(stderr, "error: could not take connection\n");
+            ret = 1;
+            break;
+        }
+        job.fd = conn;
+        job.since = now_us();
+        pthread_mutex_lock(&server.lock);
+        if (server.count < server.depth) {
+            server.queue[(server.head + server.count) % server.depth] = job;
+            server.count++;
+            pthread_cond_signal(&server.ready);
+            conn = -1;
+        }
+        pthread_mutex_unlock(&server.lock);
+        if (conn != -1) {
+            send_all(conn, &busy, sizeof(busy));
+            close(conn);
+        }
+    }
+
+    pthread_mutex_lock(&server.lock);
+    server.stop = 1;
+    pthread_cond_broadcast(&server.ready);
+    pthread_mutex_unlock(&server.lock);
+    for (i = 0; i < n; i++)
+        pthread_join(workers[i].thread, NULL);
+no_workers:
+    free(workers);
+    free(server.queue);
+    pthread_cond_destroy(&server.ready);
+    pthread_mutex_destroy(&server.lock);
+    unlink(path);
+no_listen:
+    if (fd != -1)
+        close(fd);
+no_socket:
+    return ret;
+}
+
+/* Have the server at path run a job, copying its messages to err as they
+ * come. Return 0 once the reply is in, -1 if the server could not be
+ * reached or went away. */
+int
+send_job(const char *path, Request *req, Reply *reply, int err)
+{
+    struct sockaddr_un addr;
+    Header h;
+    char *text, *p, buf[0x1000];
+    size_t len, left;
+    int fd, i, ret = -1;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path))
+        goto no_socket;
+    strcpy(addr.sun_path, path);
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd == -1)
+        goto no_socket;
+    if (connect(fd, (struct sockaddr *) &addr, sizeof(addr)) == -1)
+        goto no_connection;
+    len = strlen(req->dir) + 1;
+    for (i = 0; i < req->argc; i++)
+        len += strlen(req->argv[i]) + 1;
+    if (len > MAX_REQUEST || req->argc > MAX_ARGS)
+        goto no_connection;
+    text = malloc(len);
+    if (!text)
+        goto no_connection;
+    p = text;
+    p = strcpy(p, req->dir) + strlen(req->dir) + 1;
+    for (i = 0; i < req->argc; i++)
+        p = strcpy(p, req->argv[i]) + strlen(req->argv[i]) + 1;
+    h.len = len;
+    h.argc = req->argc;
+    h.rows = req->rows;
+    h.cols = req->cols;
+    /* a busy server may have replied and hung up before reading these */
+    if (send_all(fd, &h, sizeof(h)) == 0)
+        send_all(fd, text, len);
+    free(text);
+    if (recv_all(fd, reply, sizeof(*reply)) == -1)
+        goto no_connection;
+    for (left = reply->loglen; left > 0; left -= len) {
+        len = left < sizeof(buf) ? left : sizeof(buf);
+        if (recv_all(fd, buf, len) == -1)
+            goto no_connection;
+        if (write(err, buf, len) == -1)
+            break;
+    }
+    ret = 0;
+no_connection:
+    close(fd);
+no_socket:
+    return ret;
+}
@@ -0,0 +1,28 @@
+#include <stdint.h>
+
+/* Status of a job the server had no room for. */
+#define JOB_BUSY    -1
+
+/* A job as sent by a client: its command line, the directory it was given
+ * in, and the size of the client's terminal, 0 if unknown. */
+typedef struct Request {
+    int argc;
+    char **argv;
+    char *dir;
+    int rows, cols;
+} Request;
+
+/* What the server sends back once the job is done, followed by loglen
+ * bytes of messages. Times are in microseconds. */
+typedef struct Reply {
+    int32_t status;
+    uint32_t loglen;
+    int64_t queued, took;
+    uint64_t bytes_in, bytes_out;
+    int64_t played;
+} Reply;
+
+typedef int (*JobFunc)(int id, Request *req, FILE *log, Reply *reply);
+
+int serve(const char *path, int nworkers, int depth, JobFunc work);
+int send_job(const char *path, Request *req, Reply *reply, int err);
@@ -0,0 +1,30 @@
+/* Playback of a session, private to congif.c and main.c: see congif.h. */
+struct Session {
+    Config cfg;
+    struct Term *term;
+    struct Cache *cache;    /* NULL if the session is only played */
+    struct Cache *warm;     /* kept by the caller, reused if of the font */
+    struct GIF *gif;
+    int last;       /* shows the last frame when closed */
+    long line;      /* timing lines taken in */
+    int64_t d;      /* since the last frame, in microseconds */
+    int64_t now;    /* with fps, since the first line */
+    long tick;      /* with fps, next tick to show */
+    int64_t clock;  /* in the timings, up to the last line */
+    int ended;      /* past the end of the window */
+    uint16_t rd, id;
+};
+
+Session *new_warm_session(const Config *cfg, struct Cache *warm,
+                          int (*write)(void *arg, const uint8_t *data, size_t len),
+                          void *arg);
+Session *dup_session(Session *s);
+int start_part(Session *s,
+               int (*write)(void *arg, const uint8_t *data, size_t len),
+               void *arg, int shown, int last);
+int join_part(Session *s, int fd);
+void resume_session(Session *s, long line, int64_t clock);
+long session_line(Session *s);
+int64_t session_clock(Session *s);
+int session_ended(Session *s);
+struct Term *session_term(Session *s);
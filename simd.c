@@ -0,0 +1,177 @@
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #define X86 1
+  #include <immintrin.h>
+#else
+  #define X86 0
+#endif
+
+#include "simd.h"
+
+#define ONES    0x0101010101010101ULL
+#define HIGHS   0x8080808080808080ULL
+
+/* Portable versions, comparing 8 bytes at a time. */
+
+static int
+first_diff_word(const uint8_t *a, const uint8_t *b, int n)
+{
+    uint64_t x, y;
+    int i = 0;
+
+    for (; i + 8 <= n; i += 8) {
+        memcpy(&x, &a[i], 8);
+        memcpy(&y, &b[i], 8);
+        if (x != y)
+            break;
+    }
+    for (; i < n; i++)
+        if (a[i] != b[i])
+            return i;
+    return n;
+}
+
+static int
+last_diff_word(const uint8_t *a, const uint8_t *b, int n)
+{
+    uint64_t x, y;
+    int i = n;
+
+    for (; i >= 8; i -= 8) {
+        memcpy(&x, &a[i-8], 8);
+        memcpy(&y, &b[i-8], 8);
+        if (x != y)
+            break;
+    }
+    for (; i > 0; i--)
+        if (a[i-1] != b[i-1])
+            return i;
+    return 0;
+}
+
+#if X86
+
+static int
+first_diff_sse2(const uint8_t *a, const uint8_t *b, int n)
+{
+    __m128i x, y;
+    int i, mask;
+
+    for (i = 0; i + 16 <= n; i += 16) {
+        x = _mm_loadu_si128((const __m128i *) &a[i]);
+        y = _mm_loadu_si128((const __m128i *) &b[i]);
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xFFFF;
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    return i + first_diff_word(&a[i], &b[i], n - i);
+}
+
+static int
+last_diff_sse2(const uint8_t *a, const uint8_t *b, int n)
+{
+    __m128i x, y;
+    int i, mask;
+
+    for (i = n; i >= 16; i -= 16) {
+        x = _mm_loadu_si128((const __m128i *) &a[i-16]);
+        y = _mm_loadu_si128((const __m128i *) &b[i-16]);
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xFFFF;
+        if (mask)
+            return i - 16 + 32 - __builtin_clz(mask);
+    }
+    return last_diff_word(a, b, i);
+}
+
+__attribute__((target("avx2"))) static int
+first_diff_avx2(const uint8_t *a, const uint8_t *b, int n)
+{
+    __m256i x, y;
+    unsigned mask;
+    int i;
+
+    for (i = 0; i + 32 <= n; i += 32) {
+        x = _mm256_loadu_si256((const __m256i *) &a[i]);
+        y = _mm256_loadu_si256((const __m256i *) &b[i]);
+        mask = ~(unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y));
+        if (mask)
+            return i + __builtin_ctz(mask);
+    }
+    return i + first_diff_sse2(&a[i], &b[i], n - i);
+}
+
+__attribute__((target("avx2"))) static int
+last_diff_avx2(const uint8_t *a, const uint8_t *b, int n)
+{
+    __m256i x, y;
+    unsigned mask;
+    int i;
+
+    for (i = n; i >= 32; i -= 32) {
+        x = _mm256_loadu_si256((const __m256i *) &a[i-32]);
+        y = _mm256_loadu_si256((const __m256i *) &b[i-32]);
+        mask = ~(unsigned) _mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y));
+        if (mask)
+            return i - 32 + 32 - __builtin_clz(mask);
+    }
+    return last_diff_sse2(a, b, i);
+}
+
+#endif /* X86 */
+
+int (*first_diff)(const uint8_t *a, const uint8_t *b, int n) = first_diff_word;
+int (*last_diff)(const uint8_t *a, const uint8_t *b, int n) = last_diff_word;
+
+static void
+pick(void)
+{
+#if X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        first_diff = first_diff_avx2;
+        last_diff = last_diff_avx2;
+    } else if (__builtin_cpu_supports("sse2")) {
+        first_diff = first_diff_sse2;
+        last_diff = last_diff_sse2;
+    } else
+#endif
+    {
+        first_diff = first_diff_word;
+        last_diff = last_diff_word;
+    }
+}
+
+/* Done once for all threads, each of which must call it before using
+ * first_diff() or last_diff(). */
+void
+init_simd(void)
+{
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+    pthread_once(&once, pick);
+}
+
+/* Each source byte is broadcast to 8 bytes, the i-th of which keeps only
+ * bit 7-i; non-zero bytes are then turned into 0xFF. */
+void
+expand_bits(uint8_t *dst, const uint8_t *src, int n)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    const uint64_t bits = 0x8040201008040201ULL;
+#else
+    const uint64_t bits = 0x0102040810204080ULL;
+#endif
+    uint64_t x;
+    int i;
+
+    for (i = 0; i < n; i += 8) {
+        x = (*src++ * ONES) & bits;
+        /* high bit of each byte set if the byte is non-zero */
+        x = ((x | ((x | HIGHS) - ONES)) & HIGHS) >> 7;
+        x *= 0xFF;
+        memcpy(&dst[i], &x, n - i < 8 ? n - i : 8);
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef CONGIF_SIMD_H
+#define CONGIF_SIMD_H
+
+#include <stdint.h>
+
+/* Vectorized pixel loops.
+ * The best implementation for the running CPU is picked by init_simd()
+ * (AVX2 or SSE2 on x86, 64-bit words elsewhere). */
+
+void init_simd(void);
+
+/* Index of the first byte that differs between a and b, or n if none. */
+extern int (*first_diff)(const uint8_t *a, const uint8_t *b, int n);
+/* Index past the last byte that differs between a and b, or 0 if none. */
+extern int (*last_diff)(const uint8_t *a, const uint8_t *b, int n);
+/* Expand the first n bits of src (MSB first) to n bytes of 0x00 or 0xFF. */
+void expand_bits(uint8_t *dst, const uint8_t *src, int n);
+
+#endif
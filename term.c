@@ -3,35 +3,33 @@
 #include <stdint.h>
 #include <string.h>
 #include <stdarg.h>
+#include <limits.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "term.h"
 #include "default.h"
 #include "cs_vtg.h"
 #include "cs_437.h"
+#include "vt_table.h"
 
+#define MIN(A, B)   ((A) < (B) ? (A) : (B))
 #define MAX(A, B)   ((A) > (B) ? (A) : (B))
 #define CLEARWRAP   do{ if (term->col >= term->cols) term->col = term->cols-1; }while(0)
 #define CLIPROW(X)  if (term->row<0 || term->row >= term->rows) term->row = X
 #define CLIPCOL(X)  if (term->col<0 || term->col >= term->cols) term->col = X
 
-static int verbose = 0;
-
 static void
-logfmt(char *fmt, ...)
+logfmt(Term *term, char *fmt, ...)
 {
     va_list args;
     va_start(args, fmt);
-    if (verbose)
+    if (term->verbose)
         vfprintf(stderr, fmt, args);
     va_end(args);
 }
 
-void
-set_verbosity(int level)
-{
-    verbose = level;
-}
-
 static void
 save_cursor(Term *term)
 {
@@ -75,8 +73,11 @@ load_misc(Term *term)
     term->cs_index = term->save_misc.cs_index;
 }
 
-void
-set_default_palette(char * pname)
+/* Load a palette into plt: one of the standard ones by '@name', or the
+ * colours set in a file on top of those already in plt.
+ * Return 0 on success, -1 on error. */
+int
+load_palette(const char *pname, uint8_t *plt)
 {
     static struct {
         char * name;
@@ -94,24 +95,20 @@ set_default_palette(char * pname)
         int i;
         for(i=0; pal[i].name; i++) {
             if (strcasecmp(pname+1, pal[i].name) == 0) {
-                def_plt = pal[i].plt;
-                return;
+                memcpy(plt, pal[i].plt, 0x30);
+                return 0;
             }
         }
         fprintf(stderr, "Known standard palette names are:\n");
         for(i=0; pal[i].name; i++)
             fprintf(stderr, "    @%s\n", pal[i].name);
-        exit(2);
+        return -1;
     } else {
         FILE * fd;
         char buf[BUFSIZ];
-        Term * term = 0;
-        uint8_t * plt = malloc(sizeof(term->plt));
-        memcpy(plt, def_plt, sizeof(term->plt));
-        def_plt = plt;
 
         if ((fd = fopen(pname, "r")) == 0) {
-            perror(pname); exit(1);
+            perror(pname); return -1;
         }
         while (fgets(buf, sizeof(buf), fd) != 0) {
             char * s = buf, *e;
@@ -131,7 +128,7 @@ set_default_palette(char * pname)
 
             cno = strtol(s, &e, 0);
             if (s == e) goto bad_line;
-            if (cno < 0 || cno > 16) goto bad_line;
+            if (cno < 0 || cno > 15) goto bad_line;
 
             s = e;
             while (*s == ' ' || *s == '\t' || *s == '#' || *s == '=') s++;
@@ -144,12 +141,58 @@ set_default_palette(char * pname)
             continue;
 bad_line:
             fprintf(stderr, "Bad line in colour file: %s", buf);
-            exit(2);
+            fclose(fd);
+            return -1;
         }
 
         fclose(fd);
     }
-    return;
+    return 0;
+}
+
+static void
+damage(Term *term, int row, int lo, int hi)
+{
+    Span *span;
+
+    if (row < 0 || row >= term->rows)
+        return;
+    lo = MAX(lo, 0);
+    hi = MIN(hi, term->cols);
+    if (lo >= hi)
+        return;
+    span = &term->damage[row];
+    if (lo < span->lo) span->lo = lo;
+    if (hi > span->hi) span->hi = hi;
+}
+
+static void
+damage_rows(Term *term, int top, int bot)
+{
+    int row;
+    for (row = top; row <= bot; row++)
+        term->damage[row] = (Span) {0, term->cols};
+}
+
+/* Damage the cells that look different because the cursor moved or
+ * the screen was reversed since the last call. */
+void
+damage_cursor(Term *term)
+{
+    int row = term->row, col = term->col;
+
+    if ((term->mode ^ term->shown_mode) & M_REVERSE) {
+        damage_rows(term, 0, term->rows-1);
+    } else if (row != term->shown_row || col != term->shown_col ||
+               (term->mode ^ term->shown_mode) & M_CURSORVIS) {
+        if (term->shown_mode & M_CURSORVIS)
+            damage(term, term->shown_row, term->shown_col, term->shown_col+1);
+        if (term->mode & M_CURSORVIS)
+            damage(term, row, col, col+1);
+    }
+    term->shown_row = row;
+    term->shown_col = col;
+    term->shown_mode = term->mode;
 }
 
 static void
@@ -168,36 +211,190 @@ reset(Term *term)
     term->cs_index = 0;
     term->state = S_ANY;
     term->parlen = 0;
-    if (memcmp(term->plt, def_plt, sizeof(term->plt) != 0)) {
+    if (memcmp(term->plt, term->def_plt, sizeof(term->plt)) != 0) {
         term->plt_dirty = 1;
     }
-    memcpy(term->plt, def_plt, sizeof(term->plt));
+    memcpy(term->plt, term->def_plt, sizeof(term->plt));
     term->plt_local = 0;
     for (i = 0; i < term->rows; i++) {
         term->addr[i] = &term->cells[i*term->cols];
         for (j = 0; j < term->cols; j++)
             term->addr[i][j] = (Cell) {EMPTY, def_attr, def_pair};
     }
+    damage_rows(term, 0, term->rows-1);
     save_cursor(term);
     save_misc(term);
 }
 
+static void
+init_term(Term *term)
+{
+    reset(term);
+    term->shown_row = term->row;
+    term->shown_col = term->col;
+    term->shown_mode = term->mode;
+    term->plt_dirty = 0;
+}
+
 Term *
-new_term(int rows, int cols)
+new_term(int rows, int cols, const uint8_t *plt)
 {
-    size_t size = sizeof(Term) + rows*sizeof(Cell *) + rows*cols*sizeof(Cell);
+    size_t size = sizeof(Term) + rows*sizeof(Cell *) + rows*sizeof(Span) +
+                  rows*cols*sizeof(Cell);
     Term *term = malloc(size);
     if (!term)
         return NULL;
     term->rows = rows;
     term->cols = cols;
     term->addr = (Cell **) &term[1];
-    term->cells = (Cell *) &term->addr[rows];
-    reset(term);
-    term->plt_dirty = 0;
+    term->damage = (Span *) &term->addr[rows];
+    term->cells = (Cell *) &term->damage[rows];
+    memcpy(term->def_plt, plt, sizeof(term->def_plt));
+    term->verbose = 0;
+    init_term(term);
     return term;
 }
 
+/* Copy of term, parser state included, with every cell damaged so that
+ * its first render draws the whole screen. */
+Term *
+dup_term(Term *term)
+{
+    size_t size = sizeof(Term) + term->rows*sizeof(Cell *) + term->rows*sizeof(Span) +
+                  term->rows*term->cols*sizeof(Cell);
+    int i;
+    Term *copy = malloc(size);
+    if (!copy)
+        return NULL;
+    memcpy(copy, term, size);
+    copy->addr = (Cell **) &copy[1];
+    copy->damage = (Span *) &copy->addr[copy->rows];
+    copy->cells = (Cell *) &copy->damage[copy->rows];
+    /* rows are rotated by scrolling */
+    for (i = 0; i < copy->rows; i++)
+        copy->addr[i] = &copy->cells[term->addr[i] - term->cells];
+    damage_rows(copy, 0, copy->rows-1);
+    return copy;
+}
+
+/* Snapshots hold every field as a 32-bit little-endian number, and the
+ * cells row by row, so that they can be read back on any platform.
+ * TERM_VERSION must change whenever the fields do. */
+#define TERM_VERSION 1
+
+static void
+put_int(FILE *f, int32_t n)
+{
+    uint32_t u = n;
+    fputc(u & 0xFF, f);
+    fputc((u >> 8) & 0xFF, f);
+    fputc((u >> 16) & 0xFF, f);
+    fputc(u >> 24, f);
+}
+
+static int32_t
+get_int(FILE *f)
+{
+    uint32_t u = 0;
+    int i;
+    for (i = 0; i < 4; i++)
+        u |= (uint32_t) (fgetc(f) & 0xFF) << (8*i);
+    return (int32_t) u;
+}
+
+/* Write or read the state of term, so both ways share the same order. */
+static void
+xfer_term(Term *term, FILE *f, int load)
+{
+    #define INT(X)  do { if (load) (X) = get_int(f); else put_int(f, (X)); } while (0)
+    Cell *cell;
+    uint32_t packed;
+    int i, j;
+
+    INT(term->row); INT(term->col);
+    INT(term->top); INT(term->bot);
+    INT(term->mode);
+    INT(term->attr); INT(term->pair);
+    INT(term->cs_array[0]); INT(term->cs_array[1]); INT(term->cs_index);
+    INT(term->save_cursor.row); INT(term->save_cursor.col);
+    INT(term->save_misc.row); INT(term->save_misc.col);
+    INT(term->save_misc.origin_on);
+    INT(term->save_misc.attr); INT(term->save_misc.pair);
+    INT(term->save_misc.cs_array[0]); INT(term->save_misc.cs_array[1]);
+    INT(term->save_misc.cs_index);
+    INT(term->state);
+    INT(term->parlen); INT(term->unilen);
+    for (i = 0; i < MAX_PARTIAL; i++)
+        INT(term->partial[i]);
+    for (i = 0; i < MAX_PARAMS; i++)
+        INT(term->params[i]);
+    INT(term->nparams);
+    INT(term->private); INT(term->lastpar);
+    for (i = 0; i < 0x30; i++)
+        INT(term->plt[i]);
+    INT(term->plt_local); INT(term->plt_dirty);
+    for (i = 0; i < term->rows; i++) {
+        for (j = 0; j < term->cols; j++) {
+            cell = &term->addr[i][j];
+            packed = cell->code | cell->attr << 16 | (uint32_t) cell->pair << 24;
+            INT(packed);
+            *cell = (Cell) {packed & 0xFFFF, (packed >> 16) & 0xFF, packed >> 24};
+        }
+    }
+    #undef INT
+}
+
+static int
+valid_term(Term *term)
+{
+    return term->row >= 0 && term->row < term->rows &&
+           term->col >= 0 && term->col <= term->cols &&
+           term->top >= 0 && term->top <= term->bot && term->bot < term->rows &&
+           term->cs_index >= 0 && term->cs_index < 2 &&
+           term->save_misc.cs_index >= 0 && term->save_misc.cs_index < 2 &&
+           (int) term->state >= 0 && term->state < NSTATES &&
+           term->parlen >= 0 && term->parlen <= MAX_PARTIAL &&
+           term->unilen >= 0 && term->unilen <= MAX_PARTIAL &&
+           term->nparams >= 0 && term->nparams <= MAX_PARAMS;
+}
+
+/* Write a snapshot of term. Return 0 on success, -1 on error. */
+int
+save_term(Term *term, FILE *f)
+{
+    put_int(f, TERM_VERSION);
+    put_int(f, term->rows);
+    put_int(f, term->cols);
+    xfer_term(term, f, 0);
+    return ferror(f) ? -1 : 0;
+}
+
+/* Restore a snapshot into a term of the same size, as made by new_term().
+ * Every cell is damaged, so that the next render draws the whole screen.
+ * On error, the term is reset and -1 is returned. */
+int
+load_term(Term *term, FILE *f)
+{
+    int i;
+
+    if (get_int(f) != TERM_VERSION || get_int(f) != term->rows ||
+        get_int(f) != term->cols)
+        goto bad;
+    for (i = 0; i < term->rows; i++)
+        term->addr[i] = &term->cells[i*term->cols];
+    xfer_term(term, f, 1);
+    if (feof(f) || ferror(f) || !valid_term(term))
+        goto bad;
+    damage_rows(term, 0, term->rows-1);
+    term->shown_row = term->row;
+    term->shown_col = term->col;
+    term->shown_mode = term->mode;
+    return 0;
+bad:
+    init_term(term);
+    return -1;
+}
+
 static uint16_t
 char_code(Term *term)
 {
@@ -212,7 +409,7 @@ static int
 within_bounds(Term *term, int row, int col)
 {
     if (row < 0 || row >= term->rows || col < 0 || col > term->cols) {
-        logfmt("position %d,%d is out of bounds %d,%d\n",
+        logfmt(term, "position %d,%d is out of bounds %d,%d\n",
                row+1, col+1, term->rows, term->cols);
         return 0;
     } else {
@@ -237,6 +434,7 @@ scroll_up(Term *term)
     term->addr[term->top] = addr;
     for (col = 0; col < term->cols; col++)
         term->addr[term->top][col] = BLANK;
+    damage_rows(term, term->top, term->bot);
 }
 
 /* Move lines up and put a blank line at the bottom. */
@@ -256,6 +454,7 @@ scroll_down(Term *term)
     term->addr[term->bot] = addr;
     for (col = 0; col < term->cols; col++)
         term->addr[term->bot][col] = BLANK;
+    damage_rows(term, term->top, term->bot);
 }
 
 static void
@@ -283,12 +482,39 @@ addchar(Term *term, uint16_t code)
             term->addr[term->row][col] = cell;
             cell = next;
         }
+        damage(term, term->row, term->col, term->cols);
     } else {
         term->addr[term->row][term->col] = cell;
+        damage(term, term->row, term->col, term->col+1);
     }
     term->col++;
 }
 
+/* Same as calling addchar() for each byte, but fills whole row spans at once. */
+static void
+addrun(Term *term, const uint8_t *buf, size_t len)
+{
+    Cell *cell;
+    size_t n, i;
+
+    while (len) {
+        if (term->col >= term->cols || term->mode & M_INSERT ||
+            term->row < 0 || term->row >= term->rows || term->col < 0) {
+            addchar(term, *buf++);
+            len--;
+            continue;
+        }
+        n = MIN(len, (size_t) (term->cols - term->col));
+        cell = &term->addr[term->row][term->col];
+        for (i = 0; i < n; i++)
+            cell[i] = (Cell) {buf[i], term->attr, term->pair};
+        damage(term, term->row, term->col, term->col+n);
+        term->col += n;
+        buf += n;
+        len -= n;
+    }
+}
+
 static void
 linefeed(Term *term)
 {
@@ -363,7 +589,7 @@ escseq(Term *term, uint8_t byte)
         break;
     case 'H':
         /* TODO: set tab stop at current column */
-        logfmt("NYI: ESC Sequence H (HTS)\n");
+        logfmt(term, "NYI: ESC Sequence H (HTS)\n");
         break;
     case 'M':
         if (term->row == term->top)
@@ -386,7 +612,7 @@ escseq(Term *term, uint8_t byte)
         break;
     case '%':
         /* TODO: select charset */
-        logfmt("NYI: ESC Sequence %% (character set selection)\n");
+        logfmt(term, "NYI: ESC Sequence %% (character set selection)\n");
         switch(second)
         {
         case '8': /* Linux switch to UTF8 */
@@ -417,11 +643,12 @@ escseq(Term *term, uint8_t byte)
                         term->addr[i][j] = (Cell) {'E', def_attr, def_pair};
                     }
                 }
+                damage_rows(term, 0, term->rows-1);
             }
             break;
         default:
             /* TODO */
-            logfmt("NYI: ESC Sequence # 3..6 DECDWL etc\n");
+            logfmt(term, "NYI: ESC Sequence # 3..6 DECDWL etc\n");
             break;
         }
         break;
@@ -437,7 +664,7 @@ escseq(Term *term, uint8_t byte)
             term->cs_array[0] = CS_437;
             break;
         case 'K':
-            logfmt("UNS: user-defined mapping\n");
+            logfmt(term, "UNS: user-defined mapping\n");
             term->cs_array[0] = (term->mode&M_ISOLAT1)?CS_ISO:CS_BMP;
             break;
         }
@@ -454,21 +681,21 @@ escseq(Term *term, uint8_t byte)
             term->cs_array[1] = CS_437;
             break;
         case 'K':
-            logfmt("UNS: user-defined mapping\n");
+            logfmt(term, "UNS: user-defined mapping\n");
             term->cs_array[1] = (term->mode&M_ISOLAT1)?CS_ISO:CS_BMP;
             break;
         }
         break;
     case '>':
         /* TODO: set numeric keypad mode */
-        logfmt("NYI: ESC Sequence > (DECPNM)\n");
+        logfmt(term, "NYI: ESC Sequence > (DECPNM)\n");
         break;
     case '=':
         /* TODO: set application keypad mode */
-        logfmt("NYI: ESC Sequence = (DECPAM)\n");
+        logfmt(term, "NYI: ESC Sequence = (DECPAM)\n");
         break;
     default:
-        logfmt("UNS: ESC Sequence %c\n", first);
+        logfmt(term, "UNS: ESC Sequence %c\n", first);
     }
 }
 
@@ -479,9 +706,9 @@ do_linux_osc(Term *term)
     uint8_t buf[4] = {0,0,0,0};
     if (term->partial[0] == 'R')
     {
-        if (memcmp(term->plt, def_plt, sizeof(term->plt) != 0))
+        if (memcmp(term->plt, term->def_plt, sizeof(term->plt)) != 0)
             term->plt_dirty = 1;
-        memcpy(term->plt, def_plt, sizeof(term->plt));
+        memcpy(term->plt, term->def_plt, sizeof(term->plt));
         term->plt_local = 0;
         return 1;
     }
@@ -510,24 +737,18 @@ do_linux_osc(Term *term)
     return 1;
 }
 
+/* Parameters of the finished control sequence. Each non-digit byte ends a
+ * parameter; a trailing separator only adds an empty one if it is ';'. */
 static int
-getparams(char *partial, int *params, int n)
+count_params(Term *term)
 {
-    char *next;
-    char *token = partial;
-    int i = 0;
-    if (!*partial) {
-        params[0] = 0;
+    int n = term->nparams;
+
+    if (term->parlen == term->private)
         return 1;
-    }
-    while (i < n && *token) {
-        params[i++] = strtol(token, &next, 10);
-        if (*next) next++;
-        token = next;
-    }
-    if (i < n && *(token-1) == ';')
-        params[i++] = 0;
-    return i;
+    if (term->lastpar == ';' || (term->lastpar >= '0' && term->lastpar <= '9'))
+        n++;
+    return n < MAX_PARAMS ? n : MAX_PARAMS;
 }
 
 #define SWITCH(T, F, V) (T)->mode = (V) ? (T)->mode | (F) : (T)->mode & ~(F)
@@ -543,7 +764,7 @@ modeswitch(Term *term, int private, int number, int value)
             break;
         case 3:
             /* TODO: 80/132 columns mode switch */
-            logfmt("NYI: DEC mode 3\n");
+            logfmt(term, "NYI: DEC mode 3\n");
             break;
         case 5:
             SWITCH(term, M_REVERSE, value);
@@ -569,7 +790,7 @@ modeswitch(Term *term, int private, int number, int value)
             SWITCH(term, M_MOUSEX11, value);
             break;
         default:
-            logfmt("UNS: DEC mode %d\n", number);
+            logfmt(term, "UNS: DEC mode %d\n", number);
         }
     } else {
         /* ANSI modes */
@@ -584,7 +805,7 @@ modeswitch(Term *term, int private, int number, int value)
             SWITCH(term, M_NEWLINE, value);
             break;
         default:
-            logfmt("UNS: ANSI mode %d\n", number);
+            logfmt(term, "UNS: ANSI mode %d\n", number);
         }
     }
 }
@@ -763,7 +984,7 @@ sgr(Term *term, int n, int *params)
             term->pair = (term->pair & 0xF0) | (number - 100 + 8);
             break;
         default:
-            logfmt("UNS: SGR %d\n", number);
+            logfmt(term, "UNS: SGR %d\n", number);
         }
     }
 }
@@ -773,30 +994,23 @@ ctrlseq(Term *term, uint8_t byte)
 {
     int private;
     int n, k, k1;
-    int params[MAX_PARAMS];
-    char *str;
+    int *params;
     int ra, rb, ca, cb;
     int i, j;
     Cell cell;
 
     if (!within_bounds(term, term->row, term->col))
         return;
-    term->partial[term->parlen] = '\0';
-    if (*term->partial == '?') {
-        private = 1;
-        str = (char *) term->partial + 1;
-    } else {
-        private = 0;
-        str = (char *) term->partial;
-    }
-    n = getparams(str, params, MAX_PARAMS);
+    private = term->private;
+    params = term->params;
+    n = count_params(term);
     k = n ? *params : 0;
     k1 = k ? k : 1;
     switch (byte) {
     case '@':
         CLEARWRAP;
         /* TODO: insert the indicated # of blank characters */
-        logfmt("NYI: Control Sequence @ (ICH)\n");
+        logfmt(term, "NYI: Control Sequence @ (ICH)\n");
         break;
     case 'A':
         CLEARWRAP;
@@ -867,6 +1081,7 @@ ctrlseq(Term *term, uint8_t byte)
         }
         for (j = 0; j <= cb; j++)
             term->addr[rb][j] = BLANK;
+        damage_rows(term, ra, rb);
         break;
     case 'K':
         CLEARWRAP;
@@ -877,6 +1092,7 @@ ctrlseq(Term *term, uint8_t byte)
             cb = term->col;
         for (j = ca; j <= cb; j++)
             term->addr[term->row][j] = BLANK;
+        damage(term, term->row, ca, cb+1);
         break;
     case 'L':
         CLEARWRAP;
@@ -917,13 +1133,15 @@ ctrlseq(Term *term, uint8_t byte)
         cell.code = EMPTY;
         for (j = term->col; j < term->cols-k1; j++)
             term->addr[term->row][j] = term->addr[term->row][j+k1];
-        for (j = term->cols-k1; j < term->cols; j++)
+        for (j = MAX(term->cols-k1, 0); j < term->cols; j++)
             term->addr[term->row][j] = cell;
+        damage(term, term->row, MIN(term->col, MAX(term->cols-k1, 0)), term->cols);
         break;
     case 'X':
         CLEARWRAP;
-        for (j = 0; j < k1; j++)
-            term->addr[term->row][term->col+j] = BLANK;
+        for (j = term->col; j < term->cols && j < term->col+k1; j++)
+            term->addr[term->row][j] = BLANK;
+        damage(term, term->row, term->col, j);
         break;
     case 'c':
         /* Device Attributes (DA) */
@@ -936,7 +1154,7 @@ ctrlseq(Term *term, uint8_t byte)
         break;
     case 'g':
         /* TODO: clear tab stop */
-        logfmt("NYI: Control Sequence g (TBC)\n");
+        logfmt(term, "NYI: Control Sequence g (TBC)\n");
         break;
     case 'h':
         for (i = 0; i < n; i++)
@@ -956,12 +1174,17 @@ ctrlseq(Term *term, uint8_t byte)
         break;
     case 'q':
         /* TODO: set keyboard LEDs */
-        logfmt("NYI: Control Sequence q (DECLL)\n");
+        logfmt(term, "NYI: Control Sequence q (DECLL)\n");
         break;
     case 'r':
         if (n == 2) {
-            term->top = MAX(params[0], 1) - 1;
-            term->bot = MAX(params[1], 1) - 1;
+            i = MAX(params[0], 1) - 1;
+            j = MIN(MAX(params[1], 1), term->rows) - 1;
+            /* as in xterm, margins are ignored unless top < bottom */
+            if (i >= j)
+                break;
+            term->top = i;
+            term->bot = j;
         } else {
             term->top = 0;
             term->bot = term->rows - 1;
@@ -976,7 +1199,7 @@ ctrlseq(Term *term, uint8_t byte)
         load_cursor(term);
         break;
     default:
-        logfmt("UNS: Control Sequence %c\n", byte);
+        logfmt(term, "UNS: Control Sequence %c\n", byte);
     }
 }
 
@@ -984,135 +1207,195 @@ ctrlseq(Term *term, uint8_t byte)
 #define PARCAT(T, B)    ((T)->partial[(T)->parlen++] = (B))
 #define RESET_STATE(T)  do { (T)->state = S_ANY; (T)->parlen = 0; } while(0)
 #define CHARLEN(B)      ((B) < 0xE0 ? 2 : ((B) < 0xF0 ? 3 : 4))
+#define PARCOUNT(T)     do { if ((T)->parlen < MAX_PARTIAL) (T)->parlen++; } while(0)
+
+static void
+print(Term *term, uint8_t byte)
+{
+    switch (CHARSET(term)) {
+    case CS_BMP:
+        if (byte < 0x80) {
+            /* single-byte UTF-8, i.e. ASCII */
+            addchar(term, byte);
+        } else if (byte >= 0xC0) {
+            term->unilen = CHARLEN(byte);
+            PARCAT(term, byte);
+            term->state = S_UNI;
+        } else
+            addchar(term, 0xFFFD);
+        break;
+    case CS_ISO:
+        addchar(term, byte);
+        break;
+    case CS_VTG:
+        addchar(term, cs_vtg[byte]);
+        break;
+    case CS_437:
+        addchar(term, cs_437[byte]);
+        break;
+    }
+}
+
+static void
+oscput(Term *term, uint8_t byte)
+{
+    /* TODO: set/reset palette entries */
+    /* Currently this just eats the string */
+    if (term->parlen < MAX_PARTIAL-3)
+        PARCAT(term, byte);
+    else
+        term->state = S_STR;
+
+    if (term->partial[0] == 'P' && term->parlen == 8) {
+        if (do_linux_osc(term))
+            RESET_STATE(term);
+    } else if (term->partial[0] == 'R' && term->parlen == 1) {
+        if (do_linux_osc(term))
+            RESET_STATE(term);
+    }
+}
+
+static void
+step(Term *term, uint8_t byte)
+{
+    State state;
+    Transition t;
+    int class, *par;
+
+    class = vt_class[byte];
+    if (class <= K_EOL && !(term->mode & M_DISPCTRL))
+        class = K_EXEC;
+again:
+    state = term->state;
+    t = vt_table[state][class];
+    term->state = t.next;
+    switch (t.action) {
+    case DO_NONE:
+        break;
+    case DO_CLEAR:
+        memset(term->params, 0, sizeof(term->params));
+        term->nparams = 0;
+        term->private = 0;
+        term->lastpar = 0;
+        term->parlen = 0;
+        break;
+    case DO_EXEC:
+        ctrlchar(term, byte);
+        break;
+    case DO_PRINT:
+        print(term, byte);
+        break;
+    case DO_COLLECT:
+        if (term->parlen < MAX_PARTIAL)
+            PARCAT(term, byte);
+        break;
+    case DO_ESC:
+        escseq(term, byte);
+        RESET_STATE(term);
+        break;
+    case DO_DIGIT:
+        if (term->nparams < MAX_PARAMS) {
+            par = &term->params[term->nparams];
+            if (*par <= (INT_MAX - 9) / 10)
+                *par = *par * 10 + (byte - '0');
+        }
+        term->lastpar = byte;
+        PARCOUNT(term);
+        break;
+    case DO_PARAM:
+        if (byte == '?' && !term->parlen) {
+            term->private = 1;
+        } else {
+            if (term->nparams < MAX_PARAMS)
+                term->nparams++;
+            term->lastpar = byte;
+        }
+        PARCOUNT(term);
+        break;
+    case DO_CSI:
+        ctrlseq(term, byte);
+        RESET_STATE(term);
+        break;
+    case DO_OSC_PUT:
+        oscput(term, byte);
+        break;
+    case DO_OSC_END:
+        /* do_osc_etc() */
+        if (state == S_OSC)
+            logfmt(term, "NYI: Operating System Sequence\n");
+        RESET_STATE(term);
+        break;
+    case DO_ABORT:
+        /* CR or LF in a string, assume something broke */
+        RESET_STATE(term);
+        break;
+    case DO_ST:
+        /* do_osc_etc() */
+        logfmt(term, "NYI: Operating System Sequence\n");
+        /*FALLTHROUGH*/
+    case DO_REENTER:
+        term->parlen = 0;
+        goto again;
+    case DO_UNI:
+        PARCAT(term, byte);
+        if (term->parlen == term->unilen) {
+            addchar(term, char_code(term));
+            RESET_STATE(term);
+        }
+        break;
+    case DO_UNI_ABORT:
+        /* Bad suffix for a unicode sequence, dump it and interpret this byte normally. */
+        addchar(term, 0xFFFD);
+        term->parlen = 0;
+        goto again;
+    }
+}
 
 void
 parse(Term *term, uint8_t byte)
 {
-    int es;
+    step(term, byte);
+}
 
-    /* Bad suffix for a unicode sequence, dump it and interpret this byte normally. */
-    if (term->state == S_UNI && (byte < 0x80 || byte >= 0xC0)) {
-        addchar(term, 0xFFFD);
-        RESET_STATE(term);
+/* Length of the prefix of buf made of bytes 0x20..0x7F, which are printed
+ * as-is by a CS_BMP terminal in ground state. */
+static size_t
+plain_run(const uint8_t *buf, size_t len)
+{
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i limit = _mm_set1_epi8(0x1F);
+    __m128i v;
+    unsigned mask;
+
+    /* bytes >= 0x80 are negative as signed chars, so one compare does it */
+    for (; i + 16 <= len; i += 16) {
+        v = _mm_loadu_si128((const __m128i *) &buf[i]);
+        mask = _mm_movemask_epi8(_mm_cmpgt_epi8(v, limit)) ^ 0xFFFF;
+        if (mask)
+            return i + __builtin_ctz(mask);
     }
-    if (byte != 0x1B && byte < 0x20 && !(term->mode & M_DISPCTRL)) {
-        ctrlchar(term, byte);
-    } else {
-        switch (term->state) {
-        case S_ANY:
-            switch (byte) {
-            case 0x1B:
-                term->state = S_ESC;
-                break;
-            case 0x9B:
-                term->state = S_CSI;
+#endif
+    while (i < len && buf[i] >= 0x20 && buf[i] < 0x80)
+        i++;
+    return i;
+}
+
+void
+parse_buf(Term *term, const uint8_t *buf, size_t len)
+{
+    size_t run;
+
+    while (len) {
+        if (term->state == S_ANY && CHARSET(term) == CS_BMP) {
+            run = plain_run(buf, len);
+            addrun(term, buf, run);
+            buf += run;
+            len -= run;
+            if (!len)
                 break;
-            default:
-                switch (CHARSET(term)) {
-                case CS_BMP:
-                    if (byte < 0x80) {
-                        /* single-byte UTF-8, i.e. ASCII */
-                        addchar(term, byte);
-                    } else if (byte >= 0xC0) {
-                        term->unilen = CHARLEN(byte);
-                        PARCAT(term, byte);
-                        term->state = S_UNI;
-                    } else
-                        addchar(term, 0xFFFD);
-                    break;
-                case CS_ISO:
-                    addchar(term, byte);
-                    break;
-                case CS_VTG:
-                    addchar(term, cs_vtg[byte]);
-                    break;
-                case CS_437:
-                    addchar(term, cs_437[byte]);
-                    break;
-                }
-            }
-            break;
-        case S_OSCESC: case S_STRESC:
-            if (byte == '\\') {
-                /* do_osc_etc() */
-                if (term->state == S_OSCESC)
-                    logfmt("NYI: Operating System Sequence\n");
-            }
-            RESET_STATE(term);
-            term->state = S_ESC;
-            /*FALLTHROUGH*/
-        case S_ESC:
-            es = 1;
-            if (!term->parlen) {
-                if (byte == 0x5B) {
-                    term->state = S_CSI;
-                    es = 0;
-                } else if (byte == 0x5D) {
-                    term->state = S_OSC;
-                    es = 0;
-                } else if (byte == 'P' || /* DCS */
-                           byte == '_' || /* APC */
-                           byte == '^' || /* PM */
-                           byte == 'X'    /* SOS */
-                        ) {
-                    term->state = S_STR; /* A string to eat */
-                    es = 0;
-                }
-            }
-            if (es) {
-                if (byte >= 0x20 && byte < 0x30) {
-                    PARCAT(term, byte);
-                } else {
-                    escseq(term, byte);
-                    RESET_STATE(term);
-                }
-            }
-            break;
-        case S_CSI:
-            if (byte < 0x40 || byte >= 0x7F) {
-                PARCAT(term, byte);
-            } else {
-                ctrlseq(term, byte);
-                RESET_STATE(term);
-            }
-            break;
-        case S_OSC: case S_STR:
-            /* TODO: set/reset palette entries */
-            /* Currently this just eats the string */
-            if (byte == 0x1B) {
-                if (term->state == S_OSC)
-                    term->state = S_OSCESC;
-                else
-                    term->state = S_STRESC;
-            } else if (byte == 13 || byte == 10)
-                RESET_STATE(term);   /* CR or LF assume something broke */
-            else if (byte == 7) {
-                /* do_osc_etc() */
-                if (term->state == S_OSC)
-                    logfmt("NYI: Operating System Sequence\n");
-                RESET_STATE(term);
-            } else {
-                if (term->parlen < MAX_PARTIAL-3)
-                    PARCAT(term, byte);
-                else
-                    term->state = S_STR;
-
-                if (term->partial[0] == 'P' && term->parlen == 8) {
-                    if (do_linux_osc(term))
-                        RESET_STATE(term);
-                } else if (term->partial[0] == 'R' && term->parlen == 1) {
-                    if (do_linux_osc(term))
-                        RESET_STATE(term);
-                }
-            }
-            break;
-        case S_UNI:
-            PARCAT(term, byte);
-            if (term->parlen == term->unilen) {
-                addchar(term, char_code(term));
-                RESET_STATE(term);
-            }
-            break;
         }
+        step(term, *buf++);
+        len--;
     }
 }
@@ -1,3 +1,6 @@
+#ifndef CONGIF_TERM_H
+#define CONGIF_TERM_H
+
 #define A_NORMAL    0x00
 #define A_BOLD      0x01
 #define A_DIM       0x02
@@ -39,8 +42,13 @@ typedef struct Cell {
     uint8_t pair;
 } Cell;
 
+/* Columns [lo, hi) of a row that changed since the last render. */
+typedef struct Span {
+    int lo, hi;
+} Span;
+
 typedef enum CharSet {CS_BMP, CS_ISO, CS_VTG, CS_437} CharSet;
-typedef enum State {S_ANY, S_ESC, S_CSI, S_OSC, S_OSCESC, S_STR, S_STRESC, S_UNI} State;
+typedef enum State {S_ANY, S_ESC, S_ESCINT, S_CSI, S_OSC, S_OSCESC, S_STR, S_STRESC, S_UNI, NSTATES} State;
 
 typedef struct SaveCursor {
     int row, col;
@@ -64,6 +72,9 @@ typedef struct Term {
     uint8_t pair;
     Cell **addr;
     Cell *cells;
+    Span *damage;
+    int shown_row, shown_col;
+    uint16_t shown_mode;
     CharSet cs_array[2];
     int cs_index;
     SaveCursor save_cursor;
@@ -72,11 +83,22 @@ typedef struct Term {
     int parlen;
     int unilen;
     uint8_t partial[MAX_PARTIAL];
+    int params[MAX_PARAMS];
+    int nparams;
+    uint8_t private, lastpar;
     uint8_t plt[0x30];
     uint8_t plt_local, plt_dirty;
+    uint8_t def_plt[0x30]; /* restored by a reset */
+    int verbose; /* log unsupported sequences to stderr */
 } Term;
 
-void set_verbosity(int level);
-Term *new_term(int rows, int cols);
+Term *new_term(int rows, int cols, const uint8_t *plt);
+Term *dup_term(Term *term);
+int save_term(Term *term, FILE *f);
+int load_term(Term *term, FILE *f);
 void parse(Term *term, uint8_t byte);
-void set_default_palette(char * optarg);
+void parse_buf(Term *term, const uint8_t *buf, size_t len);
+void damage_cursor(Term *term);
+int load_palette(const char *pname, uint8_t *plt);
+
+#endif
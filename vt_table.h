@@ -0,0 +1,154 @@
+/* Dialogue parser tables, after the DEC VT500 state diagram.
+ * Every byte is first mapped to a class, then (state, class) gives the
+ * action to run and the next state. C0 controls that are not displayed
+ * (i.e. when M_DISPCTRL is off) are moved to the virtual class K_EXEC
+ * before the lookup, since they are executed from any state. */
+
+typedef enum Class {
+    K_CTRL,     /* C0 control other than the ones below */
+    K_BEL,      /* 0x07 */
+    K_EOL,      /* 0x0A, 0x0D */
+    K_ESC,      /* 0x1B */
+    K_INTER,    /* 0x20..0x2F: intermediate */
+    K_DIGIT,    /* 0x30..0x39 */
+    K_PARAM,    /* 0x3A..0x3F: other parameter bytes */
+    K_FINAL,    /* 0x40..0x7E not listed below */
+    K_CSI,      /* '[' */
+    K_OSC,      /* ']' */
+    K_STR,      /* 'P', 'X', '^', '_': DCS, SOS, PM, APC */
+    K_ST,       /* '\\' */
+    K_DEL,      /* 0x7F */
+    K_C1,       /* 0x80..0xBF but 0x9B: UTF-8 continuation */
+    K_CSI8,     /* 0x9B */
+    K_HIGH,     /* 0xC0..0xFF: UTF-8 lead */
+    K_EXEC,     /* executed C0 control (virtual) */
+    NCLASSES
+} Class;
+
+typedef enum Action {
+    DO_NONE,        /* just change state */
+    DO_CLEAR,       /* start a control sequence */
+    DO_EXEC,        /* ctrlchar() */
+    DO_PRINT,       /* put a character according to the charset */
+    DO_COLLECT,     /* escape sequence intermediate */
+    DO_ESC,         /* escseq() */
+    DO_DIGIT,       /* accumulate parameter digit */
+    DO_PARAM,       /* private marker or parameter separator */
+    DO_CSI,         /* ctrlseq() */
+    DO_OSC_PUT,     /* string byte */
+    DO_OSC_END,     /* string terminated by BEL */
+    DO_ABORT,       /* string broken by CR or LF */
+    DO_ST,          /* string terminated by ESC \ */
+    DO_REENTER,     /* string left by ESC: redo byte in S_ESC */
+    DO_UNI,         /* UTF-8 continuation byte */
+    DO_UNI_ABORT    /* bad UTF-8 continuation: redo byte in S_ANY */
+} Action;
+
+typedef struct Transition {
+    uint8_t action;
+    uint8_t next;
+} Transition;
+
+#define X4(K)   K, K, K, K
+#define X16(K)  X4(K), X4(K), X4(K), X4(K)
+
+static const uint8_t vt_class[0x100] = {
+    X4(K_CTRL), K_CTRL, K_CTRL, K_CTRL, K_BEL,
+    K_CTRL, K_CTRL, K_EOL, K_CTRL, K_CTRL, K_EOL, K_CTRL, K_CTRL,
+    X4(K_CTRL), X4(K_CTRL),
+    K_CTRL, K_CTRL, K_CTRL, K_ESC, X4(K_CTRL),
+    X16(K_INTER),
+    X4(K_DIGIT), X4(K_DIGIT), K_DIGIT, K_DIGIT,
+    K_PARAM, K_PARAM, K_PARAM, K_PARAM, K_PARAM, K_PARAM,
+    X16(K_FINAL),
+    K_STR, K_FINAL, K_FINAL, K_FINAL, X4(K_FINAL),
+    K_STR, K_FINAL, K_FINAL, K_CSI, K_ST, K_OSC, K_STR, K_STR,
+    X16(K_FINAL),
+    X4(K_FINAL), X4(K_FINAL), X4(K_FINAL), K_FINAL, K_FINAL, K_FINAL, K_DEL,
+    X16(K_C1),
+    X4(K_C1), X4(K_C1), K_C1, K_C1, K_C1, K_CSI8, X4(K_C1),
+    X16(K_C1),
+    X16(K_C1),
+    X16(K_HIGH), X16(K_HIGH), X16(K_HIGH), X16(K_HIGH)
+};
+
+#define ESC_ROW(S) \
+    [K_CTRL] = {DO_ESC, S_ANY}, [K_BEL] = {DO_ESC, S_ANY}, \
+    [K_EOL] = {DO_ESC, S_ANY}, [K_ESC] = {DO_ESC, S_ANY}, \
+    [K_INTER] = {DO_COLLECT, S_ESCINT}, [K_DIGIT] = {DO_ESC, S_ANY}, \
+    [K_PARAM] = {DO_ESC, S_ANY}, [K_FINAL] = {DO_ESC, S_ANY}, \
+    [K_ST] = {DO_ESC, S_ANY}, [K_DEL] = {DO_ESC, S_ANY}, \
+    [K_C1] = {DO_ESC, S_ANY}, [K_CSI8] = {DO_ESC, S_ANY}, \
+    [K_HIGH] = {DO_ESC, S_ANY}, [K_EXEC] = {DO_EXEC, S}
+
+#define STRING_ROW(S, SESC) \
+    [K_CTRL] = {DO_OSC_PUT, S}, [K_BEL] = {DO_OSC_END, S_ANY}, \
+    [K_EOL] = {DO_ABORT, S_ANY}, [K_ESC] = {DO_NONE, SESC}, \
+    [K_INTER] = {DO_OSC_PUT, S}, [K_DIGIT] = {DO_OSC_PUT, S}, \
+    [K_PARAM] = {DO_OSC_PUT, S}, [K_FINAL] = {DO_OSC_PUT, S}, \
+    [K_CSI] = {DO_OSC_PUT, S}, [K_OSC] = {DO_OSC_PUT, S}, \
+    [K_STR] = {DO_OSC_PUT, S}, [K_ST] = {DO_OSC_PUT, S}, \
+    [K_DEL] = {DO_OSC_PUT, S}, [K_C1] = {DO_OSC_PUT, S}, \
+    [K_CSI8] = {DO_OSC_PUT, S}, [K_HIGH] = {DO_OSC_PUT, S}, \
+    [K_EXEC] = {DO_EXEC, S}
+
+#define STRESC_ROW(S, ST) \
+    [K_CTRL] = {DO_REENTER, S_ESC}, [K_BEL] = {DO_REENTER, S_ESC}, \
+    [K_EOL] = {DO_REENTER, S_ESC}, [K_ESC] = {DO_REENTER, S_ESC}, \
+    [K_INTER] = {DO_REENTER, S_ESC}, [K_DIGIT] = {DO_REENTER, S_ESC}, \
+    [K_PARAM] = {DO_REENTER, S_ESC}, [K_FINAL] = {DO_REENTER, S_ESC}, \
+    [K_CSI] = {DO_REENTER, S_ESC}, [K_OSC] = {DO_REENTER, S_ESC}, \
+    [K_STR] = {DO_REENTER, S_ESC}, [K_ST] = {ST, S_ESC}, \
+    [K_DEL] = {DO_REENTER, S_ESC}, [K_C1] = {DO_REENTER, S_ESC}, \
+    [K_CSI8] = {DO_REENTER, S_ESC}, [K_HIGH] = {DO_REENTER, S_ESC}, \
+    [K_EXEC] = {DO_EXEC, S}
+
+static const Transition vt_table[NSTATES][NCLASSES] = {
+    [S_ANY] = {
+        [K_CTRL] = {DO_PRINT, S_ANY}, [K_BEL] = {DO_PRINT, S_ANY},
+        [K_EOL] = {DO_PRINT, S_ANY}, [K_ESC] = {DO_NONE, S_ESC},
+        [K_INTER] = {DO_PRINT, S_ANY}, [K_DIGIT] = {DO_PRINT, S_ANY},
+        [K_PARAM] = {DO_PRINT, S_ANY}, [K_FINAL] = {DO_PRINT, S_ANY},
+        [K_CSI] = {DO_PRINT, S_ANY}, [K_OSC] = {DO_PRINT, S_ANY},
+        [K_STR] = {DO_PRINT, S_ANY}, [K_ST] = {DO_PRINT, S_ANY},
+        [K_DEL] = {DO_PRINT, S_ANY}, [K_C1] = {DO_PRINT, S_ANY},
+        [K_CSI8] = {DO_CLEAR, S_CSI}, [K_HIGH] = {DO_PRINT, S_ANY},
+        [K_EXEC] = {DO_EXEC, S_ANY}
+    },
+    [S_ESC] = {
+        ESC_ROW(S_ESC),
+        [K_CSI] = {DO_CLEAR, S_CSI}, [K_OSC] = {DO_NONE, S_OSC},
+        [K_STR] = {DO_NONE, S_STR}
+    },
+    [S_ESCINT] = {
+        ESC_ROW(S_ESCINT),
+        [K_CSI] = {DO_ESC, S_ANY}, [K_OSC] = {DO_ESC, S_ANY},
+        [K_STR] = {DO_ESC, S_ANY}
+    },
+    [S_CSI] = {
+        [K_CTRL] = {DO_PARAM, S_CSI}, [K_BEL] = {DO_PARAM, S_CSI},
+        [K_EOL] = {DO_PARAM, S_CSI}, [K_ESC] = {DO_PARAM, S_CSI},
+        [K_INTER] = {DO_PARAM, S_CSI}, [K_DIGIT] = {DO_DIGIT, S_CSI},
+        [K_PARAM] = {DO_PARAM, S_CSI}, [K_FINAL] = {DO_CSI, S_ANY},
+        [K_CSI] = {DO_CSI, S_ANY}, [K_OSC] = {DO_CSI, S_ANY},
+        [K_STR] = {DO_CSI, S_ANY}, [K_ST] = {DO_CSI, S_ANY},
+        [K_DEL] = {DO_PARAM, S_CSI}, [K_C1] = {DO_PARAM, S_CSI},
+        [K_CSI8] = {DO_PARAM, S_CSI}, [K_HIGH] = {DO_PARAM, S_CSI},
+        [K_EXEC] = {DO_EXEC, S_CSI}
+    },
+    [S_OSC] = { STRING_ROW(S_OSC, S_OSCESC) },
+    [S_OSCESC] = { STRESC_ROW(S_OSCESC, DO_ST) },
+    [S_STR] = { STRING_ROW(S_STR, S_STRESC) },
+    [S_STRESC] = { STRESC_ROW(S_STRESC, DO_REENTER) },
+    [S_UNI] = {
+        [K_CTRL] = {DO_UNI_ABORT, S_ANY}, [K_BEL] = {DO_UNI_ABORT, S_ANY},
+        [K_EOL] = {DO_UNI_ABORT, S_ANY}, [K_ESC] = {DO_UNI_ABORT, S_ANY},
+        [K_INTER] = {DO_UNI_ABORT, S_ANY}, [K_DIGIT] = {DO_UNI_ABORT, S_ANY},
+        [K_PARAM] = {DO_UNI_ABORT, S_ANY}, [K_FINAL] = {DO_UNI_ABORT, S_ANY},
+        [K_CSI] = {DO_UNI_ABORT, S_ANY}, [K_OSC] = {DO_UNI_ABORT, S_ANY},
+        [K_STR] = {DO_UNI_ABORT, S_ANY}, [K_ST] = {DO_UNI_ABORT, S_ANY},
+        [K_DEL] = {DO_UNI_ABORT, S_ANY}, [K_C1] = {DO_UNI, S_UNI},
+        [K_CSI8] = {DO_UNI, S_UNI}, [K_HIGH] = {DO_UNI_ABORT, S_ANY},
+        [K_EXEC] = {DO_UNI_ABORT, S_ANY}
+    }
+};